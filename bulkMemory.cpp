@@ -0,0 +1,369 @@
+/******************************************************************************
+** Program name: bulkMemory.cpp
+** Class name: CS325-400
+** Author: Ben Fridkis
+** Date: 10/18/2026
+** Description: The bulk memory arena. By default bulk arrays come from the
+**				standard allocator one vector at a time, scattered over 4 KB
+**				pages, so walking an n x n distance matrix misses the TLB on
+**				nearly every row. With --bulk-memory, arrays of a page and up
+**				are instead carved out of large blocks mapped with mmap (a
+**				block per array for the biggest ones): on ordinary pages
+**				(arena), advised for transparent huge pages (thp), or taken
+**				from the huge page pool reserved in /proc/sys/vm/nr_hugepages
+**				(hugetlb, falling back to thp if the pool is empty). A block
+**				is unmapped once every array carved from it is freed, so the
+**				edge heaps are still gone before the distances are stored.
+**				With --numa interleave each block is spread over the NUMA
+**				nodes (mbind, MPOL_INTERLEAVE); otherwise pages stay on the
+**				node of the thread that first writes them. Bulk arrays are
+**				not written when they are constructed (bulkMemory.hpp), so
+**				that thread is the pool thread filling each block of rows
+**				of a distance matrix (solverDriver.cpp, tspMetrics.hpp) and
+**				the worker thread annealing each tour (see
+**				simulatedAnnealing.cpp).
+*******************************************************************************/
+
+#include "bulkMemory.hpp"
+#include <map>
+#include <mutex>
+#include <new>
+#include <string>
+#include <fstream>
+#include <sstream>
+#include <cstdio>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+using std::string;
+using std::map;
+using std::mutex;
+using std::lock_guard;
+using std::ifstream;
+
+//Arrays smaller than a page come from the standard allocator in any mode.
+static const std::size_t SMALLEST_BULK_BYTES = 4096;
+
+//Arena block size. Arrays over a quarter of it get a block of their own.
+static const std::size_t BLOCK_BYTES = 64 * 1024 * 1024;
+
+//Huge page size (x86-64); blocks are mapped at multiples of it.
+static const std::size_t HUGE_PAGE_BYTES = 2 * 1024 * 1024;
+
+//Allocation granularity within a block (a cache line).
+static const std::size_t CARVE_ALIGNMENT = 64;
+
+//(From linux/mempolicy.h, not included so that no NUMA headers are needed.)
+static const int INTERLEAVE_POLICY = 3;		//MPOL_INTERLEAVE
+
+//A mapped block: arrays are carved from the front, and it is unmapped (or, if it
+//is the block being carved, rewound) when the last of them is released.
+struct ArenaBlock{
+	std::size_t size;
+	std::size_t used;
+	long liveArrays;
+	bool fromHugePagePool;
+};
+
+//The arena's state. (Set up once by configureBulkMemory, before any bulk array
+//is allocated; the mutex guards the rest.)
+struct BulkArena{
+	BulkPages pages;
+	NumaPlacement placement;
+	unsigned long nodeMask;		//NUMA nodes online
+	int nodeCount;
+	mutex lock;
+	map<char*, ArenaBlock> blocks;
+	char* carving;				//Block arrays are being carved from (or nullptr)
+	std::size_t mappedBytes;
+	std::size_t peakMappedBytes;
+	std::size_t poolBytes;			//Mapped from the huge page pool
+	std::size_t fallbackBytes;		//Asked of the pool but mapped as thp instead
+	std::size_t peakHugePageBytes;	//Most transparent huge pages seen in use
+	long blocksMapped;
+	BulkArena()
+	{
+		pages = STANDARD_ALLOCATOR;
+		placement = FIRST_TOUCH;
+		nodeMask = 1;
+		nodeCount = 1;
+		carving = nullptr;
+		mappedBytes = 0;
+		peakMappedBytes = 0;
+		poolBytes = 0;
+		fallbackBytes = 0;
+		peakHugePageBytes = 0;
+		blocksMapped = 0;
+	}
+};
+
+static BulkArena arena;
+
+static std::size_t roundUp(std::size_t bytes, std::size_t multiple)
+{
+	return (bytes + multiple - 1) / multiple * multiple;
+}
+
+//Reads the online NUMA nodes (e.g. "0-1,3") into arena.nodeMask.
+static void readNumaNodes()
+{
+	ifstream file("/sys/devices/system/node/online");
+	string text;
+	if(!(file >> text))
+	{
+		return;
+	}
+	unsigned long mask = 0;
+	std::stringstream ranges(text);
+	string range;
+	while(getline(ranges, range, ','))
+	{
+		int first = 0, last = 0;
+		int fields = sscanf(range.c_str(), "%d-%d", &first, &last);
+		if(fields < 2)
+		{
+			last = first;
+		}
+		for(int node = first; node <= last && node < 64; node++)
+		{
+			mask |= 1UL << node;
+		}
+	}
+	if(mask != 0)
+	{
+		arena.nodeMask = mask;
+		arena.nodeCount = __builtin_popcountl(mask);
+	}
+}
+
+//Returns the kernel's transparent huge page mode (always, madvise or never).
+static string transparentHugePageMode()
+{
+	ifstream file("/sys/kernel/mm/transparent_hugepage/enabled");
+	string word;
+	while(file >> word)
+	{
+		if(word.size() > 2 && word[0] == '[')
+		{
+			return word.substr(1, word.size() - 2);
+		}
+	}
+	return "unavailable";
+}
+
+//Notes how much of the process is on transparent huge pages right now (see
+//AnonHugePages in /proc/self/smaps_rollup), keeping the most seen.
+static void sampleHugePages()
+{
+	ifstream file("/proc/self/smaps_rollup");
+	string line;
+	while(getline(file, line))
+	{
+		unsigned long kilobytes;
+		if(sscanf(line.c_str(), "AnonHugePages: %lu kB", &kilobytes) == 1)
+		{
+			std::size_t bytes = static_cast<std::size_t>(kilobytes) * 1024;
+			if(bytes > arena.peakHugePageBytes)
+			{
+				arena.peakHugePageBytes = bytes;
+			}
+			return;
+		}
+	}
+}
+
+//Maps a block of size bytes (a multiple of HUGE_PAGE_BYTES) as the mode asks.
+static char* mapBlock(std::size_t size, bool& fromHugePagePool)
+{
+	void* memory = MAP_FAILED;
+	fromHugePagePool = false;
+	if(arena.pages == EXPLICIT_HUGE_PAGES)
+	{
+		memory = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+		              MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+		if(memory != MAP_FAILED)
+		{
+			fromHugePagePool = true;
+			arena.poolBytes += size;
+		}
+		else
+		{
+			arena.fallbackBytes += size;
+		}
+	}
+	if(memory == MAP_FAILED)
+	{
+		//(Over-map by a huge page and trim, so the block starts on a huge page
+		//boundary and every 2 MB of it can be backed by one huge page.)
+		void* mapped = mmap(nullptr, size + HUGE_PAGE_BYTES, PROT_READ | PROT_WRITE,
+		                    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if(mapped == MAP_FAILED)
+		{
+			throw std::bad_alloc();
+		}
+		char* start = static_cast<char*>(mapped);
+		char* aligned = reinterpret_cast<char*>(roundUp(reinterpret_cast<std::size_t>(start),
+		                                                HUGE_PAGE_BYTES));
+		if(aligned > start)
+		{
+			munmap(start, aligned - start);
+		}
+		munmap(aligned + size, start + HUGE_PAGE_BYTES - aligned);
+		memory = aligned;
+		if(arena.pages != ARENA_SMALL_PAGES)
+		{
+			madvise(memory, size, MADV_HUGEPAGE);
+		}
+	}
+	if(arena.placement == INTERLEAVED && arena.nodeCount > 1)
+	{
+		syscall(SYS_mbind, memory, size, INTERLEAVE_POLICY, &arena.nodeMask,
+		        8 * sizeof(arena.nodeMask), 0);
+	}
+	arena.mappedBytes += size;
+	arena.blocksMapped++;
+	if(arena.mappedBytes > arena.peakMappedBytes)
+	{
+		arena.peakMappedBytes = arena.mappedBytes;
+	}
+	return static_cast<char*>(memory);
+}
+
+static void unmapBlock(map<char*, ArenaBlock>::iterator block)
+{
+	if(arena.pages == TRANSPARENT_HUGE_PAGES || arena.fallbackBytes > 0)
+	{
+		sampleHugePages();
+	}
+	munmap(block->first, block->second.size);
+	arena.mappedBytes -= block->second.size;
+	if(arena.carving == block->first)
+	{
+		arena.carving = nullptr;
+	}
+	arena.blocks.erase(block);
+}
+
+//Sets where bulk arrays come from. (Called once, before any is allocated.)
+void configureBulkMemory(BulkPages pages, NumaPlacement placement)
+{
+	arena.pages = pages;
+	arena.placement = placement;
+	if(pages != STANDARD_ALLOCATOR)
+	{
+		readNumaNodes();
+	}
+}
+
+bool bulkArenaEnabled()
+{
+	return arena.pages != STANDARD_ALLOCATOR;
+}
+
+/**************************************************************************************
+**                                  allocateBulk                                     **
+** Returns bytes of memory for a bulk array. Small arrays, and all arrays with the   **
+** standard allocator, come from operator new. Otherwise the array is carved from    **
+** the current block, or from a new one if it does not fit; an array over a quarter  **
+** of a block gets a block of its own, so it is unmapped as soon as it is freed.     **
+**************************************************************************************/
+void* allocateBulk(std::size_t bytes)
+{
+	if(arena.pages == STANDARD_ALLOCATOR || bytes < SMALLEST_BULK_BYTES)
+	{
+		return ::operator new(bytes);
+	}
+	lock_guard<mutex> guard(arena.lock);
+	std::size_t carved = roundUp(bytes, CARVE_ALIGNMENT);
+	char* base;
+	if(carved > BLOCK_BYTES / 4)
+	{
+		ArenaBlock block;
+		block.size = roundUp(carved, HUGE_PAGE_BYTES);
+		block.used = carved;
+		block.liveArrays = 1;
+		base = mapBlock(block.size, block.fromHugePagePool);
+		arena.blocks[base] = block;
+		return base;
+	}
+	if(arena.carving == nullptr || arena.blocks[arena.carving].used + carved > BLOCK_BYTES)
+	{
+		//(The old block stays mapped until its last array is released.)
+		ArenaBlock block;
+		block.size = BLOCK_BYTES;
+		block.used = 0;
+		block.liveArrays = 0;
+		arena.carving = mapBlock(block.size, block.fromHugePagePool);
+		arena.blocks[arena.carving] = block;
+	}
+	ArenaBlock& block = arena.blocks[arena.carving];
+	base = arena.carving + block.used;
+	block.used += carved;
+	block.liveArrays++;
+	return base;
+}
+
+//Releases an array from allocateBulk (bytes as allocated).
+void releaseBulk(void* memory, std::size_t bytes)
+{
+	if(arena.pages == STANDARD_ALLOCATOR || bytes < SMALLEST_BULK_BYTES)
+	{
+		::operator delete(memory);
+		return;
+	}
+	lock_guard<mutex> guard(arena.lock);
+	map<char*, ArenaBlock>::iterator block = arena.blocks.upper_bound(static_cast<char*>(memory));
+	--block;
+	if(--block->second.liveArrays > 0)
+	{
+		return;
+	}
+	if(block->first == arena.carving)
+	{
+		block->second.used = 0;
+	}
+	else
+	{
+		unmapBlock(block);
+	}
+}
+
+//Returns a line describing the mode and what the arena mapped (for the output).
+string describeBulkMemory()
+{
+	if(arena.pages == STANDARD_ALLOCATOR)
+	{
+		return "standard allocator";
+	}
+	lock_guard<mutex> guard(arena.lock);
+	if(arena.pages == TRANSPARENT_HUGE_PAGES || arena.fallbackBytes > 0)
+	{
+		sampleHugePages();
+	}
+	char text[256];
+	const double megabyte = 1024.0 * 1024.0;
+	string description = "arena";
+	if(arena.pages == ARENA_SMALL_PAGES)
+	{
+		description += " on 4 KB pages";
+	}
+	else if(arena.pages == TRANSPARENT_HUGE_PAGES)
+	{
+		snprintf(text, sizeof(text), " on transparent huge pages (kernel mode %s, peak %.1f MB in use)",
+		         transparentHugePageMode().c_str(), arena.peakHugePageBytes / megabyte);
+		description += text;
+	}
+	else
+	{
+		snprintf(text, sizeof(text), " on explicit huge pages (%.1f MB from the pool, %.1f MB "
+		         "fell back to transparent huge pages)", arena.poolBytes / megabyte,
+		         arena.fallbackBytes / megabyte);
+		description += text;
+	}
+	snprintf(text, sizeof(text), ", %s over %d NUMA node%s, %.1f MB mapped at peak in %ld block%s",
+	         arena.placement == INTERLEAVED ? "interleaved" : "first touch", arena.nodeCount,
+	         arena.nodeCount == 1 ? "" : "s", arena.peakMappedBytes / megabyte, arena.blocksMapped,
+	         arena.blocksMapped == 1 ? "" : "s");
+	description += text;
+	return description;
+}
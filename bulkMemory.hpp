@@ -0,0 +1,94 @@
+/******************************************************************************
+** Program name: bulkMemory.hpp
+** Class name: CS325-400
+** Author: Ben Fridkis
+** Date: 10/18/2026
+** Description: Declarations for the arena the solvers' bulk arrays (the
+**				distance matrices, the edge heaps, the per-city and per-edge
+**				arrays of the constructors, spatial grid and steepest
+**				descent, and the annealing tours) are allocated from,
+**				optionally on huge pages and spread over the NUMA nodes.
+*******************************************************************************/
+
+#ifndef BULK_MEMORY_HPP
+#define BULK_MEMORY_HPP
+
+#include <vector>
+#include <string>
+#include <cstddef>
+#include <new>
+#include <utility>
+
+//Where bulk arrays come from, selectable with --bulk-memory. The default is the
+//standard allocator, one vector at a time; the others carve the arrays out of
+//large blocks mapped for the purpose (see bulkMemory.cpp).
+enum BulkPages{
+	STANDARD_ALLOCATOR,
+	ARENA_SMALL_PAGES,			//Arena blocks on ordinary 4 KB pages
+	TRANSPARENT_HUGE_PAGES,		//Arena blocks advised for transparent huge pages
+	EXPLICIT_HUGE_PAGES			//Arena blocks from the reserved huge page pool
+};
+
+//NUMA placement of arena blocks, selectable with --numa.
+enum NumaPlacement{
+	FIRST_TOUCH,		//Pages land on the node of the thread that first writes them
+	INTERLEAVED			//Pages are spread round robin over every node
+};
+
+void configureBulkMemory(BulkPages pages, NumaPlacement placement);
+
+bool bulkArenaEnabled();
+
+void* allocateBulk(std::size_t bytes);
+
+void releaseBulk(void* memory, std::size_t bytes);
+
+std::string describeBulkMemory();
+
+//Standard library allocator taking its memory from allocateBulk.
+template <class T>
+struct BulkAllocator{
+	typedef T value_type;
+	BulkAllocator() {}
+	template <class U>
+	BulkAllocator(const BulkAllocator<U>&) {}
+	T* allocate(std::size_t count)
+	{
+		return static_cast<T*>(allocateBulk(count * sizeof(T)));
+	}
+	void deallocate(T* memory, std::size_t count)
+	{
+		releaseBulk(memory, count * sizeof(T));
+	}
+	//Elements constructed without a value are default initialized (left as they
+	//are, for ints), so BulkVector<int>(n) and resize(n) do not touch the memory:
+	//its pages are placed by the thread that fills them (see bulkMemory.cpp).
+	template <class U>
+	void construct(U* memory)
+	{
+		::new(static_cast<void*>(memory)) U;
+	}
+	template <class U, class... Arguments>
+	void construct(U* memory, Arguments&&... arguments)
+	{
+		::new(static_cast<void*>(memory)) U(std::forward<Arguments>(arguments)...);
+	}
+};
+
+template <class T, class U>
+bool operator==(const BulkAllocator<T>&, const BulkAllocator<U>&)
+{
+	return true;
+}
+
+template <class T, class U>
+bool operator!=(const BulkAllocator<T>&, const BulkAllocator<U>&)
+{
+	return false;
+}
+
+//A vector of bulk data (see configureBulkMemory).
+template <class T>
+using BulkVector = std::vector<T, BulkAllocator<T>>;
+
+#endif
@@ -0,0 +1,857 @@
+/******************************************************************************
+** Program name: candidateTours.cpp
+** Class name: CS325-400
+** Author: Ben Fridkis
+** Date: 10/18/2026
+** Description: Greedy and nearest neighbor tour constructors that need
+**				O(n k) memory instead of O(n^2). The programs' own loaders
+**				(loadGraphOfMapAsPriorityQueue, loadGraphOfMapAsMinHeaps)
+**				put every edge of the graph into heaps; here only the edges
+**				to each city's k nearest neighbors (the candidate lists) are
+**				considered. When those run out (the nearest neighbor walk
+**				reaches a city whose candidates are all visited, or greedy
+**				matching leaves several path fragments), the nearest
+**				remaining city is found with a SpatialGrid, or by a scan when
+**				the input has no coordinates. The tours are the same as the
+**				full versions' except where a candidate list runs out.
+**				The cheapest and farthest insertion constructors work the
+**				same way: a city's insertion cost is only evaluated next to
+**				the tour cities on its candidate list (or the nearest tour
+**				city), and the costs are kept in a heap that is corrected
+**				lazily, so a tour takes about O(n k log n) time instead of
+**				the O(n^2) of rescanning every city after each insertion.
+**				The parallel greedy constructor matches the same candidate
+**				edges in rounds spread over a ThreadPool, sharing a lock-free
+**				union-find. The arrays with an entry per city or per edge are
+**				bulk arrays (see bulkMemory.cpp).
+*******************************************************************************/
+
+#include "candidateTours.hpp"
+#include "spatialGrid.hpp"
+#include "tspMetrics.hpp"
+#include "threadPool.hpp"
+#include "bulkMemory.hpp"
+#include <vector>
+#include <tuple>
+#include <memory>
+#include <queue>
+#include <utility>
+#include <functional>
+#include <algorithm>
+#include <atomic>
+using std::vector;
+using std::tuple;
+using std::get;
+using std::unique_ptr;
+using std::pair;
+using std::make_pair;
+using std::priority_queue;
+
+//Fewest path ends per block in a round of loadParallelGreedyTour.
+static const int MIN_CITIES_PER_BLOCK = 1024;
+
+//The set of cities still available to join the tour (or, for the insertion
+//constructors, already in it), answering "which of them is nearest to this
+//city". Every city starts out in the set.
+template <class Distance>
+class NearestSearch
+{
+public:
+	NearestSearch(const vector<City>& cities, bool hasCoordinates, const Distance& d,
+	              int cityCount) : distance(&d), members(cityCount), position(cityCount)
+	{
+		if(hasCoordinates)
+		{
+			grid.reset(new SpatialGrid(cities));
+		}
+		for(int i = 0; i < cityCount; i++)
+		{
+			members[i] = i;
+			position[i] = i;
+		}
+	}
+	int nearest(int city) const
+	{
+		//(With m cities in the set, a grid search looks at about n / m cells, so
+		//a scan of the m cities is quicker while m < sqrt(n).)
+		long long memberCount = static_cast<long long>(members.size());
+		if(grid && memberCount * memberCount >= static_cast<long long>(position.size()))
+		{
+			return grid->nearestActive(city);
+		}
+		int best = -1;
+		for(int i = 0; i < static_cast<int>(members.size()); i++)
+		{
+			int other = members[i];
+			if(other != city && (best == -1 || (*distance)(city, other) < (*distance)(city, best)))
+			{
+				best = other;
+			}
+		}
+		return best;
+	}
+	void deactivate(int city)
+	{
+		if(grid)
+		{
+			grid->deactivate(city);
+		}
+		if(position[city] != -1)
+		{
+			int last = members.back();
+			members[position[city]] = last;
+			position[last] = position[city];
+			members.pop_back();
+			position[city] = -1;
+		}
+	}
+	void activate(int city)
+	{
+		if(grid)
+		{
+			grid->activate(city);
+		}
+		if(position[city] == -1)
+		{
+			position[city] = static_cast<int>(members.size());
+			members.push_back(city);
+		}
+	}
+private:
+	const Distance* distance;
+	unique_ptr<SpatialGrid> grid;
+	BulkVector<int> members;
+	BulkVector<int> position;
+};
+
+//An edge between two cities (a < b), ordered by length.
+struct CandidateEdge{
+	int length;
+	int a;
+	int b;
+	bool operator<(const CandidateEdge& other) const
+	{
+		if(length != other.length) return length < other.length;
+		if(a != other.a) return a < other.a;
+		return b < other.b;
+	}
+	bool operator==(const CandidateEdge& other) const
+	{
+		return a == other.a && b == other.b;
+	}
+};
+
+//Returns the representative of x's set (union-find with path halving).
+static int findSet(BulkVector<int>& parent, int x)
+{
+	while(parent[x] != x)
+	{
+		parent[x] = parent[parent[x]];
+		x = parent[x];
+	}
+	return x;
+}
+
+//Adds the edge a-b to the (at most two) tour neighbors of a and b.
+static void linkCities(BulkVector<int>& neighbors, BulkVector<int>& degree, int a, int b)
+{
+	neighbors[2 * a + degree[a]++] = b;
+	neighbors[2 * b + degree[b]++] = a;
+}
+
+//Returns, for each city, the cities whose candidate lists include it.
+static vector<vector<int>> reverseCandidateLists(const vector<vector<int>>& candidates)
+{
+	vector<vector<int>> listedBy(candidates.size());
+	for(int i = 0; i < static_cast<int>(candidates.size()); i++)
+	{
+		for(int j = 0; j < static_cast<int>(candidates[i].size()); j++)
+		{
+			listedBy[candidates[i][j]].push_back(i);
+		}
+	}
+	return listedBy;
+}
+
+//Returns the tour of cities 0..cityCount-1 in order (for fewer than 3 cities).
+template <class Distance>
+static tuple<int, vector<int>> trivialTour(int cityCount, const Distance& distance)
+{
+	tuple<int, vector<int>> tspTour;
+	for(int i = 0; i < cityCount; i++)
+	{
+		get<1>(tspTour).push_back(i);
+	}
+	get<0>(tspTour) = tourLength(get<1>(tspTour), distance);
+	return tspTour;
+}
+
+//Joins the paths left by greedy matching (neighbors holds each city's tour
+//edges, degree how many it has) into a tour: starting from one path, the path
+//whose end is nearest to the current end is joined on next, until every path is
+//used and the tour is closed. The tour begins at city 0.
+template <class Distance>
+static tuple<int, vector<int>> joinPaths(const vector<City>& cities, bool hasCoordinates,
+                                         const Distance& distance, BulkVector<int>& neighbors,
+                                         BulkVector<int>& degree)
+{
+	int cityCount = static_cast<int>(degree.size());
+	tuple<int, vector<int>> tspTour;
+	vector<int>& tour = get<1>(tspTour);
+
+	//Find the other end of every path (a city with no edges is a path by itself).
+	BulkVector<int> otherEnd(cityCount, -1);
+	NearestSearch<Distance> ends(cities, hasCoordinates, distance, cityCount);
+	for(int c = 0; c < cityCount; c++)
+	{
+		if(degree[c] == 2)
+		{
+			ends.deactivate(c);
+		}
+		else if(otherEnd[c] == -1)
+		{
+			int previous = c, current = c;
+			while(degree[current] > 0 && (current == c || degree[current] == 2))
+			{
+				int next = neighbors[2 * current] != previous ? neighbors[2 * current]
+				                                                : neighbors[2 * current + 1];
+				previous = current;
+				current = next;
+			}
+			otherEnd[c] = current;
+			otherEnd[current] = c;
+		}
+	}
+
+	//Join the paths, each time to the nearest unused path end.
+	int start = -1;
+	for(int c = 0; c < cityCount && start == -1; c++)
+	{
+		if(degree[c] < 2)
+		{
+			start = c;
+		}
+	}
+	int end = otherEnd[start];
+	ends.deactivate(start);
+	ends.deactivate(end);
+	for(int next = ends.nearest(end); next != -1; next = ends.nearest(end))
+	{
+		linkCities(neighbors, degree, end, next);
+		ends.deactivate(next);
+		end = otherEnd[next];
+		ends.deactivate(end);
+	}
+	linkCities(neighbors, degree, end, start);
+
+	//Walk the tour from city 0.
+	int previous = neighbors[1], current = 0;
+	for(int i = 0; i < cityCount; i++)
+	{
+		tour.push_back(current);
+		int next = neighbors[2 * current] != previous ? neighbors[2 * current]
+		                                                : neighbors[2 * current + 1];
+		previous = current;
+		current = next;
+	}
+	get<0>(tspTour) = tourLength(tour, distance);
+	return tspTour;
+}
+
+/**************************************************************************************
+**                             loadGreedyCandidateTour                               **
+** This function returns a tuple with the total tour distance ('<0>' of tuple) and a **
+** vector of cities ('<1>' of tuple). The candidate edges are taken shortest first,  **
+** each one kept if neither city already has two tour edges and it does not close a  **
+** cycle (union-find), as in loadTour. What remains is a set of paths; starting from **
+** one, the path whose end is nearest to the current end is joined on next, until    **
+** every path is used and the tour is closed. The tour begins at city 0.             **
+**************************************************************************************/
+template <class Distance>
+tuple<int, vector<int>> loadGreedyCandidateTour(const vector<City>& cities, bool hasCoordinates,
+                                                const Distance& distance,
+                                                const vector<vector<int>>& candidates)
+{
+	int cityCount = static_cast<int>(candidates.size());
+	if(cityCount < 3)
+	{
+		return trivialTour(cityCount, distance);
+	}
+
+	//(Reserved at its final size, so that with the bulk memory arena no smaller
+	//copies are left behind in the arena block, see bulkMemory.cpp.)
+	BulkVector<CandidateEdge> edges;
+	size_t edgeCount = 0;
+	for(int i = 0; i < cityCount; i++)
+	{
+		edgeCount += candidates[i].size();
+	}
+	edges.reserve(edgeCount);
+	for(int i = 0; i < cityCount; i++)
+	{
+		for(int j = 0; j < static_cast<int>(candidates[i].size()); j++)
+		{
+			CandidateEdge edge;
+			edge.a = std::min(i, candidates[i][j]);
+			edge.b = std::max(i, candidates[i][j]);
+			edge.length = distance(edge.a, edge.b);
+			edges.push_back(edge);
+		}
+	}
+	std::sort(edges.begin(), edges.end());
+	edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+	BulkVector<int> neighbors(2 * cityCount, -1), degree(cityCount, 0), parent(cityCount);
+	for(int i = 0; i < cityCount; i++)
+	{
+		parent[i] = i;
+	}
+	for(int e = 0; e < static_cast<int>(edges.size()); e++)
+	{
+		int a = edges[e].a, b = edges[e].b;
+		if(degree[a] < 2 && degree[b] < 2 && findSet(parent, a) != findSet(parent, b))
+		{
+			linkCities(neighbors, degree, a, b);
+			parent[findSet(parent, a)] = findSet(parent, b);
+		}
+	}
+	BulkVector<CandidateEdge>().swap(edges);
+	return joinPaths(cities, hasCoordinates, distance, neighbors, degree);
+}
+
+//Union-find that threads can share: parents are atomic, finds halve paths with
+//compare-and-swap, and a union links the larger root under the smaller, so the
+//sets (though not the trees) come out the same in any interleaving.
+class ConcurrentUnionFind
+{
+public:
+	explicit ConcurrentUnionFind(int count) : parent(count)
+	{
+		for(int i = 0; i < count; i++)
+		{
+			parent[i].store(i, std::memory_order_relaxed);
+		}
+	}
+	int find(int x)
+	{
+		int up = parent[x].load(std::memory_order_relaxed);
+		while(up != x)
+		{
+			int upper = parent[up].load(std::memory_order_relaxed);
+			parent[x].compare_exchange_weak(up, upper, std::memory_order_relaxed);
+			x = upper;
+			up = parent[x].load(std::memory_order_relaxed);
+		}
+		return x;
+	}
+	//Returns false if a and b were already in the same set.
+	bool unite(int a, int b)
+	{
+		for(;;)
+		{
+			a = find(a);
+			b = find(b);
+			if(a == b)
+			{
+				return false;
+			}
+			if(a < b)
+			{
+				std::swap(a, b);
+			}
+			int expected = a;
+			if(parent[a].compare_exchange_strong(expected, b, std::memory_order_relaxed))
+			{
+				return true;
+			}
+		}
+	}
+private:
+	BulkVector<std::atomic<int>> parent;
+};
+
+//Runs work(first, last) over 0..count-1 split into blocks on the pool, and
+//returns the number of blocks (block b covers count * b / blocks onward).
+static int forEachBlock(ThreadPool& pool, int count, const std::function<void(int, int, int)>& work)
+{
+	int blockCount = std::max(1, std::min(4 * pool.size(), count / MIN_CITIES_PER_BLOCK));
+	for(int block = 0; block < blockCount; block++)
+	{
+		pool.submit([&work, block, blockCount, count]()
+		{
+			work(block, static_cast<int>(static_cast<long long>(count) * block / blockCount),
+			     static_cast<int>(static_cast<long long>(count) * (block + 1) / blockCount));
+		});
+	}
+	pool.wait();
+	return blockCount;
+}
+
+/**************************************************************************************
+**                             loadParallelGreedyTour                                **
+** This function returns a tuple with the total tour distance ('<0>' of tuple) and a **
+** vector of cities ('<1>' of tuple). Greedy matching over the candidate edges as in **
+** loadGreedyCandidateTour, but in rounds that run on every core (Boruvka style):    **
+** each path end claims its shortest candidate edge that may still be added, and an  **
+** edge claimed by both of its cities is added. The shortest edge that may be added  **
+** is always claimed from both sides, so every round adds at least one edge. Edges   **
+** added in the same round can close a cycle of paths; the longest edge of each such **
+** cycle is dropped (as loadTour would have rejected it). Every decision depends     **
+** only on the edge lengths, so the tour does not depend on the number of threads.   **
+** The paths are then joined as in loadGreedyCandidateTour.                          **
+**************************************************************************************/
+template <class Distance>
+tuple<int, vector<int>> loadParallelGreedyTour(const vector<City>& cities, bool hasCoordinates,
+                                               const Distance& distance,
+                                               const vector<vector<int>>& candidates)
+{
+	int cityCount = static_cast<int>(candidates.size());
+	if(cityCount < 3)
+	{
+		return trivialTour(cityCount, distance);
+	}
+	ThreadPool pool(ThreadPool::defaultThreadCount());
+
+	//Each city's candidate edges (both directions), shortest first.
+	vector<vector<int>> listedBy = reverseCandidateLists(candidates);
+	vector<vector<CandidateEdge>> edges(cityCount);
+	forEachBlock(pool, cityCount, [&](int, int first, int last)
+	{
+		for(int i = first; i < last; i++)
+		{
+			vector<int> others(candidates[i]);
+			others.insert(others.end(), listedBy[i].begin(), listedBy[i].end());
+			for(int j = 0; j < static_cast<int>(others.size()); j++)
+			{
+				CandidateEdge edge;
+				edge.a = std::min(i, others[j]);
+				edge.b = std::max(i, others[j]);
+				edge.length = distance(edge.a, edge.b);
+				edges[i].push_back(edge);
+			}
+			std::sort(edges[i].begin(), edges[i].end());
+			edges[i].erase(std::unique(edges[i].begin(), edges[i].end()), edges[i].end());
+		}
+	});
+	vector<vector<int>>().swap(listedBy);
+
+	BulkVector<int> neighbors(2 * cityCount, -1), degree(cityCount, 0);
+	BulkVector<int> nextEdge(cityCount, 0);		//Edges before it can no longer be added
+	BulkVector<CandidateEdge> claim(cityCount, CandidateEdge());	//(Read before some are claimed.)
+	ConcurrentUnionFind paths(cityCount);
+	BulkVector<std::atomic<int>> addedEnds(cityCount), openSet(cityCount), longestEdge(cityCount);
+	BulkVector<int> ends(cityCount);
+	for(int i = 0; i < cityCount; i++)
+	{
+		addedEnds[i] = 0;
+		openSet[i] = 0;
+		longestEdge[i] = -1;
+		ends[i] = i;
+	}
+	int blockLimit = 4 * pool.size();
+	vector<vector<int>> blockEnds(blockLimit);
+	vector<vector<CandidateEdge>> blockAdded(blockLimit);
+	BulkVector<CandidateEdge> added;
+	while(!ends.empty())
+	{
+		//Each path end claims its shortest edge that may still be added (both
+		//cities have fewer than two edges and are on different paths). Ends
+		//with no such edge left drop out for good.
+		int endCount = static_cast<int>(ends.size());
+		int blocks = forEachBlock(pool, endCount, [&](int block, int first, int last)
+		{
+			blockEnds[block].clear();
+			for(int i = first; i < last; i++)
+			{
+				int city = ends[i];
+				if(degree[city] == 2)
+				{
+					continue;
+				}
+				const vector<CandidateEdge>& list = edges[city];
+				int& e = nextEdge[city];
+				while(e < static_cast<int>(list.size()))
+				{
+					int other = list[e].a == city ? list[e].b : list[e].a;
+					if(degree[other] < 2 && paths.find(city) != paths.find(other))
+					{
+						break;
+					}
+					e++;
+				}
+				if(e < static_cast<int>(list.size()))
+				{
+					claim[city] = list[e];
+					blockEnds[block].push_back(city);
+				}
+			}
+		});
+		ends.clear();
+		for(int block = 0; block < blocks; block++)
+		{
+			ends.insert(ends.end(), blockEnds[block].begin(), blockEnds[block].end());
+		}
+
+		//Edges claimed from both sides.
+		endCount = static_cast<int>(ends.size());
+		blocks = forEachBlock(pool, endCount, [&](int block, int first, int last)
+		{
+			blockAdded[block].clear();
+			for(int i = first; i < last; i++)
+			{
+				const CandidateEdge& edge = claim[ends[i]];
+				int other = edge.a == ends[i] ? edge.b : edge.a;
+				if(ends[i] == edge.a && claim[other] == edge)
+				{
+					blockAdded[block].push_back(edge);
+				}
+			}
+		});
+		added.clear();
+		for(int block = 0; block < blocks; block++)
+		{
+			added.insert(added.end(), blockAdded[block].begin(), blockAdded[block].end());
+		}
+		std::sort(added.begin(), added.end());
+		int addedCount = static_cast<int>(added.size());
+
+		//Merge the paths. Within a merged set each path has one or two added edges
+		//at its ends; the edges close a cycle if every path has two. So count the
+		//added ends of each path (by its root before merging), mark the merged
+		//sets that contain a path with one, and drop the longest edge of the rest.
+		vector<pair<int, int>> roots(addedCount);
+		forEachBlock(pool, addedCount, [&](int, int first, int last)
+		{
+			for(int i = first; i < last; i++)
+			{
+				roots[i] = make_pair(paths.find(added[i].a), paths.find(added[i].b));
+				addedEnds[roots[i].first].fetch_add(1, std::memory_order_relaxed);
+				addedEnds[roots[i].second].fetch_add(1, std::memory_order_relaxed);
+			}
+		});
+		forEachBlock(pool, addedCount, [&](int, int first, int last)
+		{
+			for(int i = first; i < last; i++)
+			{
+				paths.unite(added[i].a, added[i].b);
+			}
+		});
+		forEachBlock(pool, addedCount, [&](int, int first, int last)
+		{
+			for(int i = first; i < last; i++)
+			{
+				if(addedEnds[roots[i].first].load(std::memory_order_relaxed) == 1 ||
+				   addedEnds[roots[i].second].load(std::memory_order_relaxed) == 1)
+				{
+					openSet[paths.find(added[i].a)].store(1, std::memory_order_relaxed);
+				}
+			}
+		});
+		forEachBlock(pool, addedCount, [&](int, int first, int last)
+		{
+			for(int i = first; i < last; i++)
+			{
+				int root = paths.find(added[i].a);
+				if(openSet[root].load(std::memory_order_relaxed) == 0)
+				{
+					int longest = longestEdge[root].load(std::memory_order_relaxed);
+					while(longest < i && !longestEdge[root].compare_exchange_weak(longest, i))
+					{
+					}
+				}
+			}
+		});
+
+		//Add the edges (a city is in at most one of them, as it claims one).
+		forEachBlock(pool, addedCount, [&](int, int first, int last)
+		{
+			for(int i = first; i < last; i++)
+			{
+				int root = paths.find(added[i].a);
+				if(longestEdge[root].load(std::memory_order_relaxed) != i)
+				{
+					linkCities(neighbors, degree, added[i].a, added[i].b);
+				}
+			}
+		});
+		for(int i = 0; i < addedCount; i++)
+		{
+			addedEnds[roots[i].first] = 0;
+			addedEnds[roots[i].second] = 0;
+			openSet[paths.find(added[i].a)] = 0;
+			longestEdge[paths.find(added[i].a)] = -1;
+		}
+	}
+	vector<vector<CandidateEdge>>().swap(edges);
+	return joinPaths(cities, hasCoordinates, distance, neighbors, degree);
+}
+
+/**************************************************************************************
+**                         loadNearestNeighborCandidateTour                          **
+** This function returns a tuple with the total tour distance ('<0>' of tuple) and a **
+** vector of cities ('<1>' of tuple). Starting at city 0, the tour moves each time   **
+** to the closest unvisited city on the current city's candidate list, or, if every  **
+** candidate is visited, to the closest unvisited city overall.                      **
+**************************************************************************************/
+template <class Distance>
+tuple<int, vector<int>> loadNearestNeighborCandidateTour(const vector<City>& cities, bool hasCoordinates,
+                                                         const Distance& distance,
+                                                         const vector<vector<int>>& candidates)
+{
+	int cityCount = static_cast<int>(candidates.size());
+	tuple<int, vector<int>> tspTour;
+	vector<int>& tour = get<1>(tspTour);
+	if(cityCount == 0)
+	{
+		get<0>(tspTour) = 0;
+		return tspTour;
+	}
+	vector<bool> visited(cityCount, false);
+	NearestSearch<Distance> unvisited(cities, hasCoordinates, distance, cityCount);
+	int current = 0;
+	visited[0] = true;
+	unvisited.deactivate(0);
+	tour.push_back(0);
+	for(int i = 1; i < cityCount; i++)
+	{
+		int next = -1;
+		for(int j = 0; j < static_cast<int>(candidates[current].size()) && next == -1; j++)
+		{
+			if(!visited[candidates[current][j]])
+			{
+				next = candidates[current][j];
+			}
+		}
+		if(next == -1)
+		{
+			next = unvisited.nearest(current);
+		}
+		visited[next] = true;
+		unvisited.deactivate(next);
+		tour.push_back(next);
+		current = next;
+	}
+	get<0>(tspTour) = tourLength(tour, distance);
+	return tspTour;
+}
+
+//A tour under construction by insertion: a cycle through the cities inserted so
+//far (starting with startCity alone), kept as next/previous links.
+template <class Distance>
+class InsertionTour
+{
+public:
+	InsertionTour(const vector<City>& cities, bool hasCoordinates, const Distance& d,
+	              const vector<vector<int>>& c, int startCity)
+		: distance(&d), candidates(&c), next(c.size(), -1), previous(c.size(), -1),
+		  tourCities(cities, hasCoordinates, d, static_cast<int>(c.size()))
+	{
+		for(int i = 0; i < static_cast<int>(c.size()); i++)
+		{
+			if(i != startCity)
+			{
+				tourCities.deactivate(i);
+			}
+		}
+		next[startCity] = startCity;
+		previous[startCity] = startCity;
+	}
+	bool contains(int city) const
+	{
+		return next[city] != -1;
+	}
+	int following(int city) const
+	{
+		return next[city];
+	}
+	int nearestTourCity(int city) const
+	{
+		return tourCities.nearest(city);
+	}
+	//Returns the least increase in tour length from inserting city next to a tour
+	//city on its candidate list (or, if none is in the tour yet, next to the
+	//nearest tour city), and sets after to the city it would follow.
+	int insertionCost(int city, int& after) const
+	{
+		int best = 0;
+		after = -1;
+		const vector<int>& near = (*candidates)[city];
+		for(int j = 0; j < static_cast<int>(near.size()); j++)
+		{
+			if(contains(near[j]))
+			{
+				considerEdges(city, near[j], best, after);
+			}
+		}
+		if(after == -1)
+		{
+			considerEdges(city, nearestTourCity(city), best, after);
+		}
+		return best;
+	}
+	void insert(int city, int after)
+	{
+		int before = next[after];
+		next[after] = city;
+		previous[city] = after;
+		next[city] = before;
+		previous[before] = city;
+		tourCities.activate(city);
+	}
+	//Returns the finished tour, beginning at city 0.
+	tuple<int, vector<int>> finish() const
+	{
+		tuple<int, vector<int>> tspTour;
+		vector<int>& tour = get<1>(tspTour);
+		int city = 0;
+		for(int i = 0; i < static_cast<int>(next.size()); i++)
+		{
+			tour.push_back(city);
+			city = next[city];
+		}
+		get<0>(tspTour) = tourLength(tour, *distance);
+		return tspTour;
+	}
+private:
+	//Checks the two tour edges at tour city u as places to insert city.
+	void considerEdges(int city, int u, int& best, int& after) const
+	{
+		int edgeStarts[2] = {previous[u], u};
+		for(int e = 0; e < 2; e++)
+		{
+			int a = edgeStarts[e], b = next[a];
+			int cost = (*distance)(a, city) + (*distance)(city, b) - (*distance)(a, b);
+			if(after == -1 || cost < best)
+			{
+				best = cost;
+				after = a;
+			}
+		}
+	}
+	const Distance* distance;
+	const vector<vector<int>>* candidates;
+	BulkVector<int> next;		//(-1 for cities not yet in the tour)
+	BulkVector<int> previous;
+	NearestSearch<Distance> tourCities;
+};
+
+/**************************************************************************************
+**                           loadCheapestInsertionTour                               **
+** This function returns a tuple with the total tour distance ('<0>' of tuple) and a **
+** vector of cities ('<1>' of tuple). Starting from city 0 alone, the city that adds **
+** the least to the tour length is inserted, each time, where it adds the least.     **
+** Insertion costs are kept in a min-heap. Inserting a city between after and before **
+** replaces the edge (after, before) with two edges, which only the cities listing   **
+** the new city, after or before as a candidate look at (or cities with no candidate **
+** in the tour yet, whose nearest tour city may now be the new one; these are not    **
+** tracked); their costs may have gone down, so they are recomputed and pushed again **
+** right away. Costs that went up (their insertion edge was split) are found when    **
+** popped, recomputed and pushed back.                                               **
+**************************************************************************************/
+template <class Distance>
+tuple<int, vector<int>> loadCheapestInsertionTour(const vector<City>& cities, bool hasCoordinates,
+                                                  const Distance& distance,
+                                                  const vector<vector<int>>& candidates)
+{
+	int cityCount = static_cast<int>(candidates.size());
+	if(cityCount < 3)
+	{
+		return trivialTour(cityCount, distance);
+	}
+	InsertionTour<Distance> tour(cities, hasCoordinates, distance, candidates, 0);
+	vector<vector<int>> listedBy = reverseCandidateLists(candidates);
+	priority_queue<pair<int, int>, BulkVector<pair<int, int>>, std::greater<pair<int, int>>> costs;
+	for(int city = 1; city < cityCount; city++)
+	{
+		costs.push(make_pair(2 * distance(0, city), city));
+	}
+	for(int inserted = 1; inserted < cityCount; )
+	{
+		pair<int, int> cheapest = costs.top();
+		costs.pop();
+		int city = cheapest.second, after;
+		if(tour.contains(city))
+		{
+			continue;		//(An outdated entry for an inserted city.)
+		}
+		int cost = tour.insertionCost(city, after);
+		if(cost > cheapest.first)
+		{
+			costs.push(make_pair(cost, city));
+			continue;
+		}
+		tour.insert(city, after);
+		inserted++;
+		int changed[3] = {city, after, tour.following(city)};
+		for(int c = 0; c < 3; c++)
+		{
+			const vector<int>& listing = listedBy[changed[c]];
+			for(int j = 0; j < static_cast<int>(listing.size()); j++)
+			{
+				int other = listing[j], otherAfter;
+				if(!tour.contains(other))
+				{
+					costs.push(make_pair(tour.insertionCost(other, otherAfter), other));
+				}
+			}
+		}
+	}
+	return tour.finish();
+}
+
+/**************************************************************************************
+**                           loadFarthestInsertionTour                               **
+** This function returns a tuple with the total tour distance ('<0>' of tuple) and a **
+** vector of cities ('<1>' of tuple). Starting from city 0 alone, the city farthest  **
+** from the tour is inserted, each time, where it adds the least to the tour length. **
+** Distances to the tour only shrink, so the max-heap holds upper bounds: the top    **
+** city's distance is recomputed (nearest tour city from the spatial index) and it   **
+** is inserted if the bound was exact, or pushed back with the smaller distance.     **
+**************************************************************************************/
+template <class Distance>
+tuple<int, vector<int>> loadFarthestInsertionTour(const vector<City>& cities, bool hasCoordinates,
+                                                  const Distance& distance,
+                                                  const vector<vector<int>>& candidates)
+{
+	int cityCount = static_cast<int>(candidates.size());
+	if(cityCount < 3)
+	{
+		return trivialTour(cityCount, distance);
+	}
+	InsertionTour<Distance> tour(cities, hasCoordinates, distance, candidates, 0);
+	priority_queue<pair<int, int>, BulkVector<pair<int, int>>> farthest;
+	for(int city = 1; city < cityCount; city++)
+	{
+		farthest.push(make_pair(distance(0, city), city));
+	}
+	for(int inserted = 1; inserted < cityCount; )
+	{
+		pair<int, int> top = farthest.top();
+		farthest.pop();
+		int city = top.second, after;
+		int toTour = distance(city, tour.nearestTourCity(city));
+		if(toTour < top.first)
+		{
+			farthest.push(make_pair(toTour, city));
+			continue;
+		}
+		tour.insertionCost(city, after);
+		tour.insert(city, after);
+		inserted++;
+	}
+	return tour.finish();
+}
+
+//(See FOR_EACH_DISTANCE_SOURCE in tspMetrics.hpp.)
+#define INSTANTIATE_CANDIDATE_TOURS(Distance) \
+	template tuple<int, vector<int>> loadGreedyCandidateTour<Distance>(const vector<City>&, bool, \
+	                                                                   const Distance&, const vector<vector<int>>&); \
+	template tuple<int, vector<int>> loadParallelGreedyTour<Distance>(const vector<City>&, bool, \
+	                                                                  const Distance&, const vector<vector<int>>&); \
+	template tuple<int, vector<int>> loadNearestNeighborCandidateTour<Distance>(const vector<City>&, bool, \
+	                                                                            const Distance&, const vector<vector<int>>&); \
+	template tuple<int, vector<int>> loadCheapestInsertionTour<Distance>(const vector<City>&, bool, \
+	                                                                     const Distance&, const vector<vector<int>>&); \
+	template tuple<int, vector<int>> loadFarthestInsertionTour<Distance>(const vector<City>&, bool, \
+	                                                                     const Distance&, const vector<vector<int>>&);
+FOR_EACH_DISTANCE_SOURCE(INSTANTIATE_CANDIDATE_TOURS)
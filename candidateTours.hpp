@@ -0,0 +1,50 @@
+/******************************************************************************
+** Program name: candidateTours.hpp
+** Class name: CS325-400
+** Author: Ben Fridkis
+** Date: 10/18/2026
+** Description: Declarations for the greedy (serial and parallel), nearest
+**				neighbor and insertion tour constructors that work from the
+**				candidate lists instead of from every edge of the graph.
+*******************************************************************************/
+
+#ifndef CANDIDATE_TOURS_HPP
+#define CANDIDATE_TOURS_HPP
+
+#include <vector>
+#include <tuple>
+#include "tspCities.hpp"
+
+//(The templates are defined in candidateTours.cpp for each distance source in
+//tspMetrics.hpp. When hasCoordinates is false, the cities are not looked at.)
+template <class Distance>
+std::tuple<int, std::vector<int>> loadGreedyCandidateTour(const std::vector<City>& cities,
+                                                          bool hasCoordinates,
+                                                          const Distance& distance,
+                                                          const std::vector<std::vector<int>>& candidates);
+
+template <class Distance>
+std::tuple<int, std::vector<int>> loadParallelGreedyTour(const std::vector<City>& cities,
+                                                         bool hasCoordinates,
+                                                         const Distance& distance,
+                                                         const std::vector<std::vector<int>>& candidates);
+
+template <class Distance>
+std::tuple<int, std::vector<int>> loadNearestNeighborCandidateTour(const std::vector<City>& cities,
+                                                                   bool hasCoordinates,
+                                                                   const Distance& distance,
+                                                                   const std::vector<std::vector<int>>& candidates);
+
+template <class Distance>
+std::tuple<int, std::vector<int>> loadCheapestInsertionTour(const std::vector<City>& cities,
+                                                            bool hasCoordinates,
+                                                            const Distance& distance,
+                                                            const std::vector<std::vector<int>>& candidates);
+
+template <class Distance>
+std::tuple<int, std::vector<int>> loadFarthestInsertionTour(const std::vector<City>& cities,
+                                                            bool hasCoordinates,
+                                                            const Distance& distance,
+                                                            const std::vector<std::vector<int>>& candidates);
+
+#endif
@@ -0,0 +1,125 @@
+/******************************************************************************
+** Program name: cityRenumbering.cpp
+** Class name: CS325-400
+** Author: Ben Fridkis
+** Date: 10/18/2026
+** Description: Relabels cities in spatial (Hilbert curve or k-d tree) order.
+**				The input file's ids are arbitrary, so the graph[a][b] and
+**				tour accesses made by 2-Opt jump randomly through memory.
+**				After relabeling, cities that are close on the map (which
+**				are the ones 2-Opt mostly compares) have close ids, so the
+**				rows and entries it touches are mostly already in cache.
+*******************************************************************************/
+
+#include "cityRenumbering.hpp"
+#include <vector>
+#include <algorithm>
+using std::vector;
+using std::nth_element;
+
+/**************************************************************************************
+**                                 kdTreeSplit                                       **
+** Recursively orders order[first, last) as the leaves of a k-d tree: the range is   **
+** split at the median of whichever axis (x or y) has the larger spread, and each    **
+** half is ordered the same way.                                                     **
+**************************************************************************************/
+static void kdTreeSplit(const vector<City>& cities, vector<int>& order, int first, int last)
+{
+	while(last - first > 2)
+	{
+		double minX = cities[order[first]].x, maxX = minX;
+		double minY = cities[order[first]].y, maxY = minY;
+		for(int i = first + 1; i < last; i++)
+		{
+			minX = std::min(minX, cities[order[i]].x);
+			maxX = std::max(maxX, cities[order[i]].x);
+			minY = std::min(minY, cities[order[i]].y);
+			maxY = std::max(maxY, cities[order[i]].y);
+		}
+		bool splitOnX = maxX - minX >= maxY - minY;
+		int middle = first + (last - first) / 2;
+		if(splitOnX)
+		{
+			nth_element(order.begin() + first, order.begin() + middle, order.begin() + last,
+			            [&cities](int a, int b) { return cities[a].x < cities[b].x; });
+		}
+		else
+		{
+			nth_element(order.begin() + first, order.begin() + middle, order.begin() + last,
+			            [&cities](int a, int b) { return cities[a].y < cities[b].y; });
+		}
+		kdTreeSplit(cities, order, first, middle);
+		first = middle;		//(The second half is handled by the loop, not recursion.)
+	}
+}
+
+//Returns the indices of the cities in k-d tree (leaf) order.
+vector<int> kdTreeOrder(const vector<City>& cities)
+{
+	vector<int> order(cities.size());
+	for(int i = 0; i < static_cast<int>(order.size()); i++)
+	{
+		order[i] = i;
+	}
+	kdTreeSplit(cities, order, 0, static_cast<int>(order.size()));
+	return order;
+}
+
+/**************************************************************************************
+**                                renumberCities                                     **
+** Reorders cities so that the city at order[i] becomes city i (its id is changed to **
+** i). Returns the cities' original positions in the input, indexed by new id, for   **
+** restoreOriginalIds and mergeTourFiles. (Positions rather than the file's id       **
+** column, since every tour these programs read or write uses 0-based input          **
+** positions.)                                                                       **
+**************************************************************************************/
+vector<int> renumberCities(vector<City>& cities, const vector<int>& order)
+{
+	vector<City> renumbered(cities.size());
+	vector<int> originalIds(cities.size());
+	for(int i = 0; i < static_cast<int>(order.size()); i++)
+	{
+		renumbered[i] = cities[order[i]];
+		originalIds[i] = order[i];
+		renumbered[i].id = i;
+	}
+	cities.swap(renumbered);
+	return originalIds;
+}
+
+//Reorders the rows and columns of a distance matrix (EXPLICIT instances) the
+//same way renumberCities reorders the cities. An empty matrix is left as is.
+void renumberEdgeWeights(DistanceMatrix& edgeWeights, const vector<int>& order)
+{
+	if(edgeWeights.empty())
+	{
+		return;
+	}
+	DistanceMatrix renumbered(order.size(), BulkVector<int>(order.size()));
+	for(int i = 0; i < static_cast<int>(order.size()); i++)
+	{
+		for(int j = 0; j < static_cast<int>(order.size()); j++)
+		{
+			renumbered[i][j] = edgeWeights[order[i]][order[j]];
+		}
+	}
+	edgeWeights.swap(renumbered);
+}
+
+/**************************************************************************************
+**                              restoreOriginalIds                                   **
+** Maps a tour given in new ids back to the cities' input positions. The tour is     **
+** then rotated to start at city 0, as the tours of un-renumbered runs do.           **
+**************************************************************************************/
+void restoreOriginalIds(vector<int>& tour, const vector<int>& originalIds)
+{
+	for(int i = 0; i < static_cast<int>(tour.size()); i++)
+	{
+		tour[i] = originalIds[tour[i]];
+	}
+	vector<int>::iterator start = std::find(tour.begin(), tour.end(), 0);
+	if(start != tour.end())
+	{
+		std::rotate(tour.begin(), start, tour.end());
+	}
+}
@@ -0,0 +1,26 @@
+/******************************************************************************
+** Program name: cityRenumbering.hpp
+** Class name: CS325-400
+** Author: Ben Fridkis
+** Date: 10/18/2026
+** Description: Declarations for relabeling cities in spatial order, so
+**				that cities near each other on the map are stored near each
+**				other in memory.
+*******************************************************************************/
+
+#ifndef CITY_RENUMBERING_HPP
+#define CITY_RENUMBERING_HPP
+
+#include <vector>
+#include "tspCities.hpp"
+#include "tspMetrics.hpp"
+
+std::vector<int> kdTreeOrder(const std::vector<City>& cities);
+
+std::vector<int> renumberCities(std::vector<City>& cities, const std::vector<int>& order);
+
+void renumberEdgeWeights(DistanceMatrix& edgeWeights, const std::vector<int>& order);
+
+void restoreOriginalIds(std::vector<int>& tour, const std::vector<int>& originalIds);
+
+#endif
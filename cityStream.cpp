@@ -0,0 +1,282 @@
+/******************************************************************************
+** Program name: cityStream.cpp
+** Class name: CS325-400
+** Author: Ben Fridkis
+** Date: 10/18/2026
+** Description: Streaming city input. The loaders used to read a named file
+**				to the end before anything else started. CityStream reads
+**				its input (which can be a pipe, so it is read once, front to
+**				back) on the calling thread and publishes the parsed cities
+**				in chunks; each consumer runs on its own thread and works on
+**				a chunk as soon as it is published, while the next chunks are
+**				still being read. The distance tile consumer fills in the
+**				triangular distance matrix this way: each chunk's rows are
+**				computed against every city read so far, a block of columns
+**				at a time so the coordinates involved stay in cache.
+*******************************************************************************/
+
+#include "cityStream.hpp"
+#include <vector>
+#include <string>
+#include <thread>
+#include <algorithm>
+#include <cstdlib>
+using std::vector;
+using std::string;
+using std::thread;
+using std::mutex;
+using std::unique_lock;
+using std::shared_ptr;
+
+//Cities per published chunk.
+static const int CITIES_PER_CHUNK = 256;
+
+//Columns per block when computing a chunk's distance rows.
+static const int TILE_COLUMNS = 1024;
+
+//Reads "city x y" from line. Returns false if the line does not start that way.
+static bool parseCityLine(const string& line, City& city)
+{
+	const char* text = line.c_str();
+	char* end;
+	long id = strtol(text, &end, 10);
+	if(end == text)
+	{
+		return false;
+	}
+	text = end;
+	double x = strtod(text, &end);
+	if(end == text)
+	{
+		return false;
+	}
+	text = end;
+	double y = strtod(text, &end);
+	if(end == text)
+	{
+		return false;
+	}
+	city = City(static_cast<int>(id), x, y);
+	return true;
+}
+
+CityStream::CityStream(std::istream& in, bool stopAtOther)
+	: input(in), stopAtOtherLines(stopAtOther), cityCount(0), finished(false) {}
+
+//Adds a consumer (before run).
+void CityStream::addConsumer(const ChunkConsumer& consumer)
+{
+	consumers.push_back(consumer);
+}
+
+//Returns the line reading stopped at (stopAtOtherLines), or "" at end of input.
+const string& CityStream::stopLine() const
+{
+	return lastLine;
+}
+
+//Hands a full chunk to the consumers and starts a new one.
+void CityStream::publish(vector<City>& chunk)
+{
+	shared_ptr<const vector<City>> published(new vector<City>(std::move(chunk)));
+	{
+		unique_lock<mutex> guard(lock);
+		chunks.push_back(published);
+		chunkStart.push_back(cityCount);
+		cityCount += static_cast<int>(published->size());
+	}
+	chunkReady.notify_all();
+	chunk.clear();
+	chunk.reserve(CITIES_PER_CHUNK);
+}
+
+//Runs one consumer on every chunk, in order, waiting for chunks not yet read.
+void CityStream::consumerLoop(int consumer)
+{
+	for(int next = 0; ; next++)
+	{
+		shared_ptr<const vector<City>> chunk;
+		int firstCity;
+		{
+			unique_lock<mutex> guard(lock);
+			while(next == static_cast<int>(chunks.size()) && !finished)
+			{
+				chunkReady.wait(guard);
+			}
+			if(next == static_cast<int>(chunks.size()))
+			{
+				return;
+			}
+			chunk = chunks[next];
+			firstCity = chunkStart[next];
+		}
+		consumers[consumer](*chunk, firstCity);
+	}
+}
+
+/**************************************************************************************
+**                                     run                                           **
+** Reads the input line by line, publishing a chunk every CITIES_PER_CHUNK cities,   **
+** until the end of input (or, with stopAtOtherLines, the first non-blank line that  **
+** is not a city). Returns every city in input order once the consumers have         **
+** finished with the last chunk.                                                     **
+**************************************************************************************/
+vector<City> CityStream::run()
+{
+	vector<thread> threads;
+	for(int i = 0; i < static_cast<int>(consumers.size()); i++)
+	{
+		threads.push_back(thread(&CityStream::consumerLoop, this, i));
+	}
+
+	vector<City> chunk;
+	chunk.reserve(CITIES_PER_CHUNK);
+	string line;
+	while(getline(input, line))
+	{
+		City city;
+		if(parseCityLine(line, city))
+		{
+			chunk.push_back(city);
+			if(static_cast<int>(chunk.size()) == CITIES_PER_CHUNK)
+			{
+				publish(chunk);
+			}
+		}
+		else if(stopAtOtherLines && line.find_first_not_of(" \t\r\n") != string::npos)
+		{
+			lastLine = line;
+			break;
+		}
+	}
+	if(!chunk.empty())
+	{
+		publish(chunk);
+	}
+	{
+		unique_lock<mutex> guard(lock);
+		finished = true;
+	}
+	chunkReady.notify_all();
+	for(int i = 0; i < static_cast<int>(threads.size()); i++)
+	{
+		threads[i].join();
+	}
+
+	vector<City> cities;
+	cities.reserve(cityCount);
+	for(int i = 0; i < static_cast<int>(chunks.size()); i++)
+	{
+		cities.insert(cities.end(), chunks[i]->begin(), chunks[i]->end());
+	}
+	chunks.clear();
+	return cities;
+}
+
+//Returns true if the distances are complete and were computed from the same
+//coordinates, in the same order, as loaded (e.g. a TSPLIB section out of id
+//order is rearranged after streaming, which invalidates them).
+bool StreamedDistances::matches(const vector<City>& loaded) const
+{
+	if(!complete || cities.size() != loaded.size())
+	{
+		return false;
+	}
+	for(int i = 0; i < static_cast<int>(loaded.size()); i++)
+	{
+		if(cities[i].x != loaded[i].x || cities[i].y != loaded[i].y)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+//Consumer computing the distance rows of each chunk (see distanceTileConsumer).
+template <class Distance>
+class DistanceTiles
+{
+public:
+	DistanceTiles(const Distance& d, StreamedDistances& s, double limit)
+		: distance(d), streamed(&s), byteLimit(limit) {}
+	void operator()(const vector<City>& chunk, int firstCity)
+	{
+		if(!streamed->complete)
+		{
+			return;
+		}
+		vector<City>& cities = streamed->cities;
+		BulkVector<int>& weights = streamed->weights;
+		cities.insert(cities.end(), chunk.begin(), chunk.end());
+		int end = firstCity + static_cast<int>(chunk.size());
+		long long needed = static_cast<long long>(end) * (end - 1) / 2;
+		if(needed * sizeof(int) > byteLimit)
+		{
+			streamed->complete = false;
+			BulkVector<int>().swap(weights);
+			vector<City>().swap(cities);
+			return;
+		}
+		weights.resize(needed);
+		for(int column = 0; column < end; column += TILE_COLUMNS)
+		{
+			for(int a = std::max(firstCity, column + 1); a < end; a++)
+			{
+				long long row = static_cast<long long>(a) * (a - 1) / 2;
+				int last = std::min(column + TILE_COLUMNS, a);
+				for(int b = column; b < last; b++)
+				{
+					weights[row + b] = distance(a, b);
+				}
+			}
+		}
+	}
+private:
+	Distance distance;		//(Reads streamed->cities.)
+	StreamedDistances* streamed;
+	double byteLimit;
+};
+
+//Makes the DistanceTiles consumer for the metric withDistanceMetric picks.
+struct TileConsumerMaker{
+	StreamedDistances& streamed;
+	double byteLimit;
+	ChunkConsumer consumer;
+	TileConsumerMaker(StreamedDistances& s, double limit) : streamed(s), byteLimit(limit) {}
+	template <class Distance>
+	void operator()(const Distance& distance)
+	{
+		consumer = DistanceTiles<Distance>(distance, streamed, byteLimit);
+	}
+};
+
+/**************************************************************************************
+**                              distanceTileConsumer                                 **
+** Returns a consumer that fills distances (weights and cities) with the lower       **
+** triangular distance matrix of the streamed cities, in the layout of               **
+** TriangularMatrixDistance, for a coordinate edge weight type. If the matrix would  **
+** need more than byteLimit bytes it is dropped and complete is set to false.        **
+** expectedCities (the TSPLIB DIMENSION, or 0 if unknown) lets the matrix be         **
+** allocated once up front.                                                          **
+**************************************************************************************/
+ChunkConsumer distanceTileConsumer(EdgeWeightType edgeWeightType, int expectedCities,
+                                   double byteLimit, StreamedDistances& distances)
+{
+	if(expectedCities > 0)
+	{
+		long long expected = static_cast<long long>(expectedCities) * (expectedCities - 1) / 2;
+		if(expected * sizeof(int) <= byteLimit)
+		{
+			distances.weights.reserve(expected);
+			distances.cities.reserve(expectedCities);
+		}
+	}
+	distances.complete = true;
+	TileConsumerMaker maker(distances, byteLimit);
+	DistanceMatrix noEdgeWeights;
+	if(edgeWeightType != EXPLICIT)
+	{
+		withDistanceMetric(edgeWeightType, distances.cities, noEdgeWeights, maker);
+	}
+	return maker.consumer;
+}
@@ -0,0 +1,69 @@
+/******************************************************************************
+** Program name: cityStream.hpp
+** Class name: CS325-400
+** Author: Ben Fridkis
+** Date: 10/18/2026
+** Description: Declarations for reading "city x y" lines from any input
+**				stream (a file, a FIFO or stdin) in chunks, handing each
+**				chunk to consumers running on their own threads while later
+**				chunks are still being read.
+*******************************************************************************/
+
+#ifndef CITY_STREAM_HPP
+#define CITY_STREAM_HPP
+
+#include <vector>
+#include <string>
+#include <istream>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include "tspCities.hpp"
+#include "tspMetrics.hpp"
+
+class CityStream
+{
+public:
+	CityStream(std::istream& input, bool stopAtOtherLines);
+	void addConsumer(const ChunkConsumer& consumer);
+	std::vector<City> run();
+	const std::string& stopLine() const;
+
+private:
+	void publish(std::vector<City>& chunk);
+	void consumerLoop(int consumer);
+
+	std::istream& input;
+	bool stopAtOtherLines;		//Stop at the first non-city line (TSPLIB sections)
+								//instead of skipping it (course format)
+	std::string lastLine;		//The line reading stopped at, if any
+	std::vector<ChunkConsumer> consumers;
+	std::vector<std::shared_ptr<const std::vector<City>>> chunks;
+	std::vector<int> chunkStart;
+	int cityCount;
+	bool finished;
+	std::mutex lock;
+	std::condition_variable chunkReady;
+
+	//(Not copyable.)
+	CityStream(const CityStream&);
+	CityStream& operator=(const CityStream&);
+};
+
+//A lower triangular distance matrix filled in while the input is read (see
+//distanceTileConsumer). cities are the coordinates the rows were computed from.
+struct StreamedDistances{
+	BulkVector<int> weights;	//TriangularMatrixDistance layout
+	std::vector<City> cities;
+	bool complete;				//False if not streamed, or the byte limit stopped it
+	StreamedDistances()
+	{
+		complete = false;
+	}
+	bool matches(const std::vector<City>& loaded) const;
+};
+
+ChunkConsumer distanceTileConsumer(EdgeWeightType edgeWeightType, int expectedCities,
+                                   double byteLimit, StreamedDistances& distances);
+
+#endif
@@ -0,0 +1,735 @@
+/******************************************************************************
+** Program name: exactSolver.cpp
+** Class name: CS325-400
+** Author: Ben Fridkis
+** Date: 10/18/2026
+** Description: Exact solvers for small instances (--exact). Up to 16
+**				cities, the Held-Karp dynamic program (Held & Karp, 1962)
+**				finds the shortest path from city 0 through each subset of
+**				the other cities (a bit mask) to each city of the subset.
+**				Subsets of the same size only depend on smaller ones, so
+**				each size is split among the threads of a ThreadPool. Up to
+**				200 cities, a branch and bound (Volgenant & Jonker, 1982)
+**				bounds each node by the Held-Karp 1-tree ascent (as in
+**				heldKarpBound.cpp), with the node's edges forced in or out,
+**				and prunes it against the best tour so far, which starts as
+**				the heuristic tour. Nodes are kept on a shared stack (depth
+**				first) that several threads take from.
+*******************************************************************************/
+
+#include "exactSolver.hpp"
+#include "threadPool.hpp"
+#include "tspMetrics.hpp"
+#include <vector>
+#include <tuple>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <sstream>
+using std::vector;
+using std::string;
+using std::tuple;
+using std::get;
+using std::thread;
+using std::mutex;
+using std::unique_lock;
+
+static const int DYNAMIC_PROGRAM_MAX_CITIES = 16;
+static const int BRANCH_AND_BOUND_MAX_CITIES = 200;
+
+//Subgradient steps for the root node's bound, and for each other node (which
+//starts from its parent's penalties).
+static const int ROOT_ASCENT_STEPS = 1000;
+static const int NODE_ASCENT_STEPS = 50;
+
+//Edge states in a branch and bound node.
+static const signed char FREE_EDGE = 0;
+static const signed char INCLUDED_EDGE = 1;
+static const signed char EXCLUDED_EDGE = -1;
+
+//Weight taken off included edges so that every minimum 1-tree uses them.
+static const double FORCING_WEIGHT = 1e12;
+
+/**************************************************************************************
+**                             heldKarpDynamicProgram                                **
+** Returns an optimal tour (from city 0) for the n x n distance matrix d. Bit i of a **
+** subset stands for city i + 1. cost[subset * m + j] is the length of the shortest  **
+** path that starts at city 0, visits exactly the cities of subset and ends at city  **
+** j + 1 (which is in subset). O(2^n n^2) time and O(2^n n) memory.                  **
+**************************************************************************************/
+static vector<int> heldKarpDynamicProgram(const vector<int>& d, int n, int threadCount)
+{
+	const int infinity = std::numeric_limits<int>::max();
+	int m = n - 1;
+	unsigned subsets = 1u << m;
+	vector<int> cost(static_cast<size_t>(subsets) * m, infinity);
+	vector<vector<unsigned>> bySize(m + 1);
+	for(unsigned subset = 1; subset < subsets; subset++)
+	{
+		int size = 0;
+		for(unsigned bits = subset; bits != 0; bits &= bits - 1)
+		{
+			size++;
+		}
+		bySize[size].push_back(subset);
+	}
+	for(int j = 0; j < m; j++)
+	{
+		cost[(static_cast<size_t>(1) << j) * m + j] = d[j + 1];
+	}
+
+	ThreadPool pool(threadCount);
+	for(int size = 2; size <= m; size++)
+	{
+		const vector<unsigned>& layer = bySize[size];
+		int blockCount = std::min(static_cast<int>(layer.size()), 4 * pool.size());
+		for(int block = 0; block < blockCount; block++)
+		{
+			pool.submit([&, block]()
+			{
+				size_t first = layer.size() * block / blockCount;
+				size_t last = layer.size() * (block + 1) / blockCount;
+				for(size_t s = first; s < last; s++)
+				{
+					unsigned subset = layer[s];
+					for(int j = 0; j < m; j++)
+					{
+						if(!(subset & (1u << j)))
+						{
+							continue;
+						}
+						unsigned previous = subset ^ (1u << j);
+						int best = infinity;
+						for(int i = 0; i < m; i++)
+						{
+							if(previous & (1u << i))
+							{
+								best = std::min(best, cost[static_cast<size_t>(previous) * m + i] +
+								                      d[(i + 1) * n + j + 1]);
+							}
+						}
+						cost[static_cast<size_t>(subset) * m + j] = best;
+					}
+				}
+			});
+		}
+		pool.wait();
+	}
+
+	//Close the tour at the best last city, then walk the subsets back.
+	unsigned subset = subsets - 1;
+	int last = 0;
+	for(int j = 1; j < m; j++)
+	{
+		if(cost[static_cast<size_t>(subset) * m + j] + d[(j + 1) * n] <
+		   cost[static_cast<size_t>(subset) * m + last] + d[(last + 1) * n])
+		{
+			last = j;
+		}
+	}
+	vector<int> tour(n);
+	tour[0] = 0;
+	for(int position = n - 1; position >= 1; position--)
+	{
+		tour[position] = last + 1;
+		unsigned previous = subset ^ (1u << last);
+		int next = -1;
+		for(int i = 0; i < m && previous != 0 && next == -1; i++)
+		{
+			if((previous & (1u << i)) &&
+			   cost[static_cast<size_t>(previous) * m + i] + d[(i + 1) * n + last + 1] ==
+			   cost[static_cast<size_t>(subset) * m + last])
+			{
+				next = i;
+			}
+		}
+		subset = previous;
+		last = next;
+	}
+	return tour;
+}
+
+//A branch and bound node: which edges are forced into or out of the tour, and
+//the 1-tree penalties its bound was computed with.
+struct BranchNode{
+	vector<signed char> edges;		//n x n, FREE_EDGE, INCLUDED_EDGE or EXCLUDED_EDGE
+	vector<double> pi;
+};
+
+//A minimum 1-tree: the spanning tree on cities 1..n-1 (parent links), plus the
+//two edges from city 0.
+struct OneTree{
+	vector<int> parent;
+	vector<int> degree;
+	int first;
+	int second;
+	double length;				//Penalized length
+};
+
+//Everything the branch and bound threads share.
+struct BranchAndBound{
+	const vector<int>* d;
+	int n;
+	vector<BranchNode> stack;
+	int busy;						//Threads working on a node
+	bool stopped;					//The time limit passed
+	std::atomic<int> bestLength;
+	vector<int> bestTour;
+	long long nodes;
+	std::atomic<long long> pathEndBranches;	//Branches on a city with an included edge
+	std::chrono::steady_clock::time_point deadline;
+	mutex lock;
+	std::condition_variable work;
+};
+
+//Returns edge a-b's weight in the node's 1-trees, or infinity if it is excluded.
+static inline double forcedWeight(const BranchAndBound& search, const vector<signed char>& edges,
+                                  const vector<double>& pi, int a, int b)
+{
+	signed char state = edges[a * search.n + b];
+	if(state == EXCLUDED_EDGE)
+	{
+		return std::numeric_limits<double>::infinity();
+	}
+	double w = (*search.d)[a * search.n + b] + pi[a] + pi[b];
+	return state == INCLUDED_EDGE ? w - FORCING_WEIGHT : w;
+}
+
+/**************************************************************************************
+**                               constrainedOneTree                                  **
+** Computes the node's minimum 1-tree (dense Prim, as denseOneTree in                **
+** heldKarpBound.cpp) with included edges weighted so they are always taken and      **
+** excluded edges left out. Returns false if the excluded edges leave no 1-tree.     **
+**************************************************************************************/
+static bool constrainedOneTree(const BranchAndBound& search, const vector<signed char>& edges,
+                               const vector<double>& pi, OneTree& tree)
+{
+	int n = search.n;
+	const double infinity = std::numeric_limits<double>::infinity();
+	vector<double> key(n, infinity);
+	vector<bool> inTree(n, false);
+	tree.parent.assign(n, -1);
+	tree.degree.assign(n, 0);
+	tree.length = 0;
+	key[1] = 0;
+	for(int added = 0; added < n - 1; added++)
+	{
+		int city = -1;
+		for(int j = 1; j < n; j++)
+		{
+			if(!inTree[j] && (city == -1 || key[j] < key[city]))
+			{
+				city = j;
+			}
+		}
+		if(key[city] == infinity)
+		{
+			return false;
+		}
+		inTree[city] = true;
+		int parent = tree.parent[city];
+		if(parent != -1)
+		{
+			tree.length += (*search.d)[parent * n + city] + pi[parent] + pi[city];
+			tree.degree[city]++;
+			tree.degree[parent]++;
+		}
+		for(int j = 1; j < n; j++)
+		{
+			double w = forcedWeight(search, edges, pi, city, j);
+			if(!inTree[j] && w < key[j])
+			{
+				key[j] = w;
+				tree.parent[j] = city;
+			}
+		}
+	}
+
+	tree.first = -1;
+	tree.second = -1;
+	for(int j = 1; j < n; j++)
+	{
+		double w = forcedWeight(search, edges, pi, 0, j);
+		if(w == infinity)
+		{
+			continue;
+		}
+		if(tree.first == -1 || w < forcedWeight(search, edges, pi, 0, tree.first))
+		{
+			tree.second = tree.first;
+			tree.first = j;
+		}
+		else if(tree.second == -1 || w < forcedWeight(search, edges, pi, 0, tree.second))
+		{
+			tree.second = j;
+		}
+	}
+	if(tree.second == -1)
+	{
+		return false;
+	}
+	const int ends[2] = {tree.first, tree.second};
+	for(int e = 0; e < 2; e++)
+	{
+		tree.length += (*search.d)[ends[e]] + pi[0] + pi[ends[e]];
+		tree.degree[ends[e]]++;
+	}
+	tree.degree[0] = 2;
+	return true;
+}
+
+/**************************************************************************************
+**                                   nodeBound                                       **
+** Runs the subgradient ascent on the node's 1-trees (the same rule as               **
+** computeHeldKarpBound) and returns the best bound, leaving the best penalties in   **
+** node.pi and their 1-tree in tree. Stops early once the bound reaches the best     **
+** tour so far (the node can be pruned) or the 1-tree is a tour. Returns infinity if **
+** the node has no 1-tree.                                                           **
+**************************************************************************************/
+static double nodeBound(BranchAndBound& search, BranchNode& node, OneTree& tree, int steps)
+{
+	int n = search.n;
+	vector<double> pi = node.pi;
+	double best = -std::numeric_limits<double>::infinity();
+	double lambda = steps == ROOT_ASCENT_STEPS ? 2.0 : 0.5;
+	const int patience = steps == ROOT_ASCENT_STEPS ? std::max(10, std::min(n / 10, 50)) : 5;
+	int sinceImprovement = 0;
+	OneTree current;
+	for(int step = 0; step < steps && lambda > 1e-4; step++)
+	{
+		if(!constrainedOneTree(search, node.edges, pi, current))
+		{
+			return std::numeric_limits<double>::infinity();
+		}
+		double piSum = 0;
+		for(int i = 0; i < n; i++)
+		{
+			piSum += pi[i];
+		}
+		double length = current.length - 2 * piSum;
+		if(length > best + 1e-9)
+		{
+			best = length;
+			node.pi = pi;
+			tree = current;
+			sinceImprovement = 0;
+		}
+		else if(++sinceImprovement >= patience)
+		{
+			lambda /= 2;
+			sinceImprovement = 0;
+		}
+
+		int upperBound = search.bestLength.load();
+		long long normSquared = 0;
+		for(int i = 0; i < n; i++)
+		{
+			normSquared += static_cast<long long>(current.degree[i] - 2) * (current.degree[i] - 2);
+		}
+		if(std::ceil(best - 1e-6) >= upperBound || normSquared == 0)
+		{
+			break;
+		}
+		double stepSize = lambda * (upperBound - length) / normSquared;
+		for(int i = 0; i < n; i++)
+		{
+			pi[i] += stepSize * (current.degree[i] - 2);
+		}
+	}
+	return best;
+}
+
+//Returns the end of the included-edge path that starts at city and leaves it
+//away from cameFrom, and counts the path's cities in count.
+static int pathEnd(const BranchAndBound& search, const BranchNode& node, int city, int cameFrom, int& count)
+{
+	int n = search.n;
+	count = 1;
+	for(;;)
+	{
+		int next = -1;
+		for(int j = 0; j < n && next == -1; j++)
+		{
+			if(j != cameFrom && j != city && node.edges[city * n + j] == INCLUDED_EDGE)
+			{
+				next = j;
+			}
+		}
+		if(next == -1)
+		{
+			return city;
+		}
+		cameFrom = city;
+		city = next;
+		count++;
+	}
+}
+
+static void setEdge(BranchNode& node, int n, int a, int b, signed char state)
+{
+	node.edges[a * n + b] = state;
+	node.edges[b * n + a] = state;
+}
+
+//Excludes every free edge at city if it already has two included edges.
+static void closeCity(BranchNode& node, int n, int city)
+{
+	int included = 0;
+	for(int j = 0; j < n; j++)
+	{
+		included += node.edges[city * n + j] == INCLUDED_EDGE;
+	}
+	if(included == 2)
+	{
+		for(int j = 0; j < n; j++)
+		{
+			if(j != city && node.edges[city * n + j] == FREE_EDGE)
+			{
+				setEdge(node, n, city, j, EXCLUDED_EDGE);
+			}
+		}
+	}
+}
+
+/**************************************************************************************
+**                                  includeEdge                                      **
+** Forces edge a-b into the node's tours. Returns false if that is impossible (a or  **
+** b already has two included edges, or the edge closes a cycle short of a full      **
+** tour). Otherwise the consequences are applied: a city with two included edges     **
+** gets all its other edges excluded, and the edge that would close the new path     **
+** into a short cycle is excluded.                                                   **
+**************************************************************************************/
+static bool includeEdge(const BranchAndBound& search, BranchNode& node, int a, int b)
+{
+	int n = search.n;
+	if(node.edges[a * n + b] == INCLUDED_EDGE)
+	{
+		return true;
+	}
+	if(node.edges[a * n + b] == EXCLUDED_EDGE)
+	{
+		return false;
+	}
+	int countA, countB;
+	int endA = pathEnd(search, node, a, -1, countA);
+	if(endA == b)
+	{
+		//(Closes the path into a cycle: only allowed if it is the whole tour.)
+		if(countA < n)
+		{
+			return false;
+		}
+		setEdge(node, n, a, b, INCLUDED_EDGE);
+		return true;
+	}
+	int endB = pathEnd(search, node, b, -1, countB);
+	setEdge(node, n, a, b, INCLUDED_EDGE);
+	closeCity(node, n, a);
+	closeCity(node, n, b);
+	if(countA + countB < n && node.edges[endA * n + endB] == FREE_EDGE)
+	{
+		setEdge(node, n, endA, endB, EXCLUDED_EDGE);
+	}
+	return true;
+}
+
+//Returns the tour formed by a 1-tree in which every city has degree 2.
+static vector<int> oneTreeTour(const OneTree& tree, int n)
+{
+	vector<vector<int>> neighbors(n);
+	for(int j = 1; j < n; j++)
+	{
+		if(tree.parent[j] != -1)
+		{
+			neighbors[j].push_back(tree.parent[j]);
+			neighbors[tree.parent[j]].push_back(j);
+		}
+	}
+	neighbors[0].push_back(tree.first);
+	neighbors[tree.first].push_back(0);
+	neighbors[0].push_back(tree.second);
+	neighbors[tree.second].push_back(0);
+	vector<int> tour;
+	int previous = -1, city = 0;
+	for(int i = 0; i < n; i++)
+	{
+		tour.push_back(city);
+		int next = neighbors[city][0] != previous ? neighbors[city][0] : neighbors[city][1];
+		previous = city;
+		city = next;
+	}
+	return tour;
+}
+
+/**************************************************************************************
+**                                 processNode                                       **
+** Bounds one node and, unless it is pruned or its 1-tree is a tour (a new best      **
+** tour, if shorter), branches on a city v with more than two 1-tree edges, using    **
+** two of its free 1-tree edges e1 and e2: (1) e1 excluded, (2) e1 included and e2   **
+** excluded, (3) both included. Returns the children to explore.                     **
+**************************************************************************************/
+static vector<BranchNode> processNode(BranchAndBound& search, BranchNode& node, int steps,
+                                      double* bound)
+{
+	int n = search.n;
+	vector<BranchNode> children;
+	OneTree tree;
+	double lowerBound = nodeBound(search, node, tree, steps);
+	if(bound != nullptr)
+	{
+		*bound = lowerBound;
+	}
+	if(lowerBound == std::numeric_limits<double>::infinity() ||
+	   std::ceil(lowerBound - 1e-6) >= search.bestLength.load())
+	{
+		return children;
+	}
+
+	int v = -1;
+	for(int i = 0; i < n; i++)
+	{
+		if(tree.degree[i] > 2 && (v == -1 || tree.degree[i] > tree.degree[v]))
+		{
+			v = i;
+		}
+	}
+	if(v == -1)
+	{
+		//The 1-tree is a tour; its (unpenalized) length is the bound.
+		vector<int> tour = oneTreeTour(tree, n);
+		int length = 0;
+		for(int i = 0; i < n; i++)
+		{
+			length += (*search.d)[tour[i] * n + tour[(i + 1) % n]];
+		}
+		unique_lock<mutex> guard(search.lock);
+		if(length < search.bestLength.load())
+		{
+			search.bestLength.store(length);
+			search.bestTour = tour;
+		}
+		return children;
+	}
+
+	vector<int> freeEdges;
+	for(int j = 0; j < n; j++)
+	{
+		bool inTree = j == v ? false :
+		              v == 0 ? (j == tree.first || j == tree.second) :
+		              j == 0 ? (v == tree.first || v == tree.second) :
+		              (tree.parent[j] == v || tree.parent[v] == j);
+		if(inTree && node.edges[v * n + j] == FREE_EDGE)
+		{
+			freeEdges.push_back(j);
+		}
+	}
+	//(v has at most one included edge, else its other edges would be excluded.)
+	int e1 = freeEdges[0], e2 = freeEdges[1];
+	if(tree.degree[v] - static_cast<int>(freeEdges.size()) == 1)
+	{
+		search.pathEndBranches++;
+	}
+
+	BranchNode excludeFirst = node;
+	setEdge(excludeFirst, n, v, e1, EXCLUDED_EDGE);
+	BranchNode includeFirst = node;
+	if(includeEdge(search, includeFirst, v, e1))
+	{
+		BranchNode includeBoth = includeFirst;
+		if(includeEdge(search, includeBoth, v, e2))
+		{
+			children.push_back(includeBoth);
+		}
+		//(If v already had an included edge, including e1 has excluded e2, and
+		//this child holds every tour through e1.)
+		if(includeFirst.edges[v * n + e2] != INCLUDED_EDGE)
+		{
+			if(includeFirst.edges[v * n + e2] == FREE_EDGE)
+			{
+				setEdge(includeFirst, n, v, e2, EXCLUDED_EDGE);
+			}
+			children.push_back(includeFirst);
+		}
+	}
+	children.push_back(excludeFirst);
+	return children;
+}
+
+//Takes nodes from the shared stack until it is empty and no other thread can
+//add to it, or the time limit passes.
+static void branchAndBoundWorker(BranchAndBound* search)
+{
+	for(;;)
+	{
+		BranchNode node;
+		{
+			unique_lock<mutex> guard(search->lock);
+			while(search->stack.empty() && search->busy > 0 && !search->stopped)
+			{
+				search->work.wait(guard);
+			}
+			if(search->stack.empty() || search->stopped)
+			{
+				search->work.notify_all();
+				return;
+			}
+			node.edges.swap(search->stack.back().edges);
+			node.pi.swap(search->stack.back().pi);
+			search->stack.pop_back();
+			search->busy++;
+			search->nodes++;
+		}
+		vector<BranchNode> children = processNode(*search, node, NODE_ASCENT_STEPS, nullptr);
+		{
+			unique_lock<mutex> guard(search->lock);
+			for(int i = 0; i < static_cast<int>(children.size()); i++)
+			{
+				search->stack.push_back(BranchNode());
+				search->stack.back().edges.swap(children[i].edges);
+				search->stack.back().pi.swap(children[i].pi);
+			}
+			search->busy--;
+			if(std::chrono::steady_clock::now() > search->deadline)
+			{
+				search->stopped = true;
+			}
+		}
+		search->work.notify_all();
+	}
+}
+
+/**************************************************************************************
+**                                solveExactlyBy                                     **
+** Replaces tspTour with an optimal tour by the given method, whatever the city      **
+** count (the dynamic program needs O(2^n n) memory, so n must stay small): the      **
+** dynamic program, or branch and bound starting from tspTour as the best tour, on   **
+** threadCount threads. If the branch and bound runs past timeLimitSeconds it stops  **
+** with the best tour found, not proven optimal.                                     **
+**************************************************************************************/
+template <class Distance>
+ExactResult solveExactlyBy(ExactMethod method, tuple<int, vector<int>>& tspTour, int cityCount,
+                           const Distance& distance, int threadCount, double timeLimitSeconds)
+{
+	ExactResult result;
+	if(cityCount < 4)
+	{
+		//(Every tour of 3 or fewer cities has the same length.)
+		result.method = DYNAMIC_PROGRAM;
+		result.provenOptimal = true;
+		result.lowerBound = get<0>(tspTour);
+		return result;
+	}
+	vector<int> d(cityCount * cityCount);
+	for(int a = 0; a < cityCount; a++)
+	{
+		for(int b = 0; b < cityCount; b++)
+		{
+			d[a * cityCount + b] = distance(a, b);
+		}
+	}
+
+	if(method == DYNAMIC_PROGRAM)
+	{
+		get<1>(tspTour) = heldKarpDynamicProgram(d, cityCount, threadCount);
+		get<0>(tspTour) = tourLength(get<1>(tspTour), distance);
+		result.method = DYNAMIC_PROGRAM;
+		result.provenOptimal = true;
+		result.lowerBound = get<0>(tspTour);
+		return result;
+	}
+
+	BranchAndBound search;
+	search.d = &d;
+	search.n = cityCount;
+	search.busy = 0;
+	search.stopped = false;
+	search.bestLength.store(get<0>(tspTour));
+	search.bestTour = get<1>(tspTour);
+	search.nodes = 1;
+	search.pathEndBranches.store(0);
+	search.deadline = std::chrono::steady_clock::now() +
+	                  std::chrono::microseconds(static_cast<long long>(timeLimitSeconds * 1e6));
+
+	//The root gets the long ascent; its children start from its penalties.
+	BranchNode root;
+	root.edges.assign(cityCount * cityCount, FREE_EDGE);
+	root.pi.assign(cityCount, 0);
+	double rootBound;
+	search.stack = processNode(search, root, ROOT_ASCENT_STEPS, &rootBound);
+
+	vector<thread> workers;
+	for(int i = 0; i < std::max(1, threadCount); i++)
+	{
+		workers.push_back(thread(branchAndBoundWorker, &search));
+	}
+	for(int i = 0; i < static_cast<int>(workers.size()); i++)
+	{
+		workers[i].join();
+	}
+
+	get<1>(tspTour) = search.bestTour;
+	get<0>(tspTour) = search.bestLength.load();
+	result.method = BRANCH_AND_BOUND;
+	result.provenOptimal = !search.stopped;
+	result.nodes = search.nodes;
+	result.pathEndBranches = search.pathEndBranches.load();
+	result.lowerBound = result.provenOptimal ? get<0>(tspTour) :
+	                    std::min(get<0>(tspTour), static_cast<int>(std::ceil(rootBound - 1e-6)));
+	return result;
+}
+
+/**************************************************************************************
+**                                 solveExactly                                      **
+** Replaces tspTour with an optimal tour: by the dynamic program for up to           **
+** DYNAMIC_PROGRAM_MAX_CITIES cities, or by branch and bound for up to               **
+** BRANCH_AND_BOUND_MAX_CITIES (see solveExactlyBy). Larger instances are left       **
+** alone.                                                                            **
+**************************************************************************************/
+template <class Distance>
+ExactResult solveExactly(tuple<int, vector<int>>& tspTour, int cityCount, const Distance& distance,
+                         int threadCount, double timeLimitSeconds)
+{
+	if(cityCount > BRANCH_AND_BOUND_MAX_CITIES)
+	{
+		return ExactResult();
+	}
+	ExactMethod method = cityCount <= DYNAMIC_PROGRAM_MAX_CITIES ? DYNAMIC_PROGRAM : BRANCH_AND_BOUND;
+	return solveExactlyBy(method, tspTour, cityCount, distance, threadCount, timeLimitSeconds);
+}
+
+//Returns a one line description of result, for the program's output.
+string describeExactResult(const ExactResult& result)
+{
+	std::ostringstream text;
+	if(result.method == NOT_ATTEMPTED)
+	{
+		text << "not attempted (more than " << BRANCH_AND_BOUND_MAX_CITIES << " cities)";
+	}
+	else if(result.method == DYNAMIC_PROGRAM)
+	{
+		text << "optimal (Held-Karp dynamic program)";
+	}
+	else if(result.provenOptimal)
+	{
+		text << "optimal (branch and bound, " << result.nodes << " nodes)";
+	}
+	else
+	{
+		text << "not proven, time budget reached (branch and bound, " << result.nodes
+		     << " nodes, lower bound " << result.lowerBound << ")";
+	}
+	return text.str();
+}
+
+//(See FOR_EACH_DISTANCE_SOURCE in tspMetrics.hpp.)
+#define INSTANTIATE_EXACT_SOLVER(Distance) \
+	template ExactResult solveExactlyBy<Distance>(ExactMethod, tuple<int, vector<int>>&, int, \
+	                                             const Distance&, int, double); \
+	template ExactResult solveExactly<Distance>(tuple<int, vector<int>>&, int, const Distance&, int, double);
+FOR_EACH_DISTANCE_SOURCE(INSTANTIATE_EXACT_SOLVER)
@@ -0,0 +1,57 @@
+/******************************************************************************
+** Program name: exactSolver.hpp
+** Class name: CS325-400
+** Author: Ben Fridkis
+** Date: 10/18/2026
+** Description: Declarations for the exact (provably optimal) solvers for
+**				small instances: the Held-Karp dynamic program and a 1-tree
+**				branch and bound.
+*******************************************************************************/
+
+#ifndef EXACT_SOLVER_HPP
+#define EXACT_SOLVER_HPP
+
+#include <vector>
+#include <tuple>
+#include <string>
+
+//How solveExactly ended.
+enum ExactMethod{
+	NOT_ATTEMPTED,			//Too many cities (see exactSolver.cpp)
+	DYNAMIC_PROGRAM,		//Held-Karp dynamic program (always optimal)
+	BRANCH_AND_BOUND		//Optimal unless stopped by the time limit
+};
+
+struct ExactResult{
+	ExactMethod method;
+	bool provenOptimal;
+	long long nodes;		//Branch and bound nodes explored
+	int lowerBound;			//Root 1-tree bound (the tour length if proven optimal)
+	long long pathEndBranches;	//Nodes branched on a city that had one included edge
+	ExactResult()
+	{
+		method = NOT_ATTEMPTED;
+		provenOptimal = false;
+		nodes = 0;
+		pathEndBranches = 0;
+		lowerBound = 0;
+	}
+};
+
+//(Defined in exactSolver.cpp for each distance source in tspMetrics.hpp.)
+//tspTour is the starting (upper bound) tour and is replaced by the best found.
+template <class Distance>
+ExactResult solveExactly(std::tuple<int, std::vector<int>>& tspTour, int cityCount,
+                         const Distance& distance, int threadCount, double timeLimitSeconds);
+
+//As solveExactly, but by the given method (DYNAMIC_PROGRAM or BRANCH_AND_BOUND)
+//whatever the city count, so the two can be checked against each other (see
+//exactSolverCheck.cpp).
+template <class Distance>
+ExactResult solveExactlyBy(ExactMethod method, std::tuple<int, std::vector<int>>& tspTour,
+                           int cityCount, const Distance& distance, int threadCount,
+                           double timeLimitSeconds);
+
+std::string describeExactResult(const ExactResult& result);
+
+#endif
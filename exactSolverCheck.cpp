@@ -0,0 +1,155 @@
+/******************************************************************************
+** Program name: exactSolverCheck.cpp
+** Class name: CS325-400
+** Author: Ben Fridkis
+** Date: 10/18/2026
+** Description: Checks the branch and bound of exactSolver.cpp against the
+**				Held-Karp dynamic program on seeded random instances, some
+**				above the dynamic program's usual limit of 16 cities (both
+**				methods are forced with solveExactlyBy): cities in the plane,
+**				uniform or clustered, and distance matrices of small random
+**				weights. The ties in the latter make the branch and bound
+**				branch on cities at the end of an included path (one
+**				included edge and two free 1-tree edges), where it once
+**				dropped the child holding every tour through the first
+**				edge (seeds 12027 and 17047 lost their optimum that way).
+**				Prints the instances that disagree and exits with 1 if any
+**				does, or if no instance branched on such a city.
+*******************************************************************************/
+
+#include <iostream>
+#include <vector>
+#include <tuple>
+#include <random>
+#include "exactSolver.hpp"
+#include "tspCities.hpp"
+#include "tspMetrics.hpp"
+#include "threadPool.hpp"
+using std::vector;
+using std::tuple;
+using std::get;
+using std::cout;
+using std::endl;
+
+static const int PLANE_INSTANCES_PER_SIZE = 6;
+static const int PLANE_SMALLEST_SIZE = 17;
+static const int PLANE_LARGEST_SIZE = 20;
+static const int MATRIX_INSTANCES_PER_SIZE = 50;
+static const int MATRIX_SIZES[] = {12, 17};
+static const int MATRIX_LARGEST_WEIGHT = 20;
+static const double TIME_LIMIT_SECONDS = 600;
+
+//Returns cityCount seeded random cities on a 1000 x 1000 square, uniform or
+//around three cluster centers.
+static vector<City> randomCities(int cityCount, bool clustered, unsigned seed)
+{
+	std::mt19937 random(seed);
+	std::uniform_real_distribution<double> square(0, 1000);
+	std::normal_distribution<double> spread(0, 40);
+	double centers[3][2];
+	for(int c = 0; c < 3; c++)
+	{
+		centers[c][0] = square(random);
+		centers[c][1] = square(random);
+	}
+	vector<City> cities;
+	for(int i = 0; i < cityCount; i++)
+	{
+		if(clustered)
+		{
+			int c = i % 3;
+			cities.push_back(City(i, centers[c][0] + spread(random), centers[c][1] + spread(random)));
+		}
+		else
+		{
+			cities.push_back(City(i, square(random), square(random)));
+		}
+	}
+	return cities;
+}
+
+//Returns a seeded symmetric cityCount x cityCount matrix of weights from 1 to
+//MATRIX_LARGEST_WEIGHT.
+static DistanceMatrix randomWeights(int cityCount, unsigned seed)
+{
+	std::mt19937 random(seed);
+	std::uniform_int_distribution<int> weight(1, MATRIX_LARGEST_WEIGHT);
+	DistanceMatrix matrix(cityCount, BulkVector<int>(cityCount, 0));
+	for(int a = 0; a < cityCount; a++)
+	{
+		for(int b = a + 1; b < cityCount; b++)
+		{
+			matrix[a][b] = matrix[b][a] = weight(random);
+		}
+	}
+	return matrix;
+}
+
+//Solves one instance both ways, starting from the tour in input order. Returns
+//false (and prints the instance) if the branch and bound does not prove the
+//dynamic program's optimum; counts its branches on path ends in pathEndBranches.
+template <class Distance>
+static bool checkInstance(const Distance& distance, int cityCount, const char* kind, unsigned seed,
+                          long long& pathEndBranches)
+{
+	int threadCount = ThreadPool::defaultThreadCount();
+	vector<int> order(cityCount);
+	for(int i = 0; i < cityCount; i++)
+	{
+		order[i] = i;
+	}
+	tuple<int, vector<int>> programTour(tourLength(order, distance), order);
+	tuple<int, vector<int>> branchTour = programTour;
+	solveExactlyBy(DYNAMIC_PROGRAM, programTour, cityCount, distance, threadCount, TIME_LIMIT_SECONDS);
+	ExactResult result = solveExactlyBy(BRANCH_AND_BOUND, branchTour, cityCount, distance,
+	                                    threadCount, TIME_LIMIT_SECONDS);
+	pathEndBranches += result.pathEndBranches;
+	if(result.provenOptimal && get<0>(branchTour) == get<0>(programTour) &&
+	   tourLength(get<1>(branchTour), distance) == get<0>(branchTour))
+	{
+		return true;
+	}
+	cout << cityCount << " cities (" << kind << ", seed " << seed << "): dynamic program "
+	     << get<0>(programTour) << ", branch and bound " << get<0>(branchTour) << " ("
+	     << result.nodes << " nodes, " << result.pathEndBranches << " on path ends)" << endl;
+	return false;
+}
+
+int main()
+{
+	int instances = 0;
+	int mismatches = 0;
+	long long pathEndBranches = 0;
+	for(int cityCount = PLANE_SMALLEST_SIZE; cityCount <= PLANE_LARGEST_SIZE; cityCount++)
+	{
+		for(int instance = 0; instance < PLANE_INSTANCES_PER_SIZE; instance++)
+		{
+			bool clustered = instance % 2 == 1;
+			unsigned seed = 1000 * cityCount + instance;
+			vector<City> cities = randomCities(cityCount, clustered, seed);
+			instances++;
+			mismatches += !checkInstance(CoordinateDistance<Euclidean2D>(cities), cityCount,
+			                             clustered ? "clustered" : "uniform", seed, pathEndBranches);
+		}
+	}
+	for(int size = 0; size < static_cast<int>(sizeof(MATRIX_SIZES) / sizeof(MATRIX_SIZES[0])); size++)
+	{
+		int cityCount = MATRIX_SIZES[size];
+		for(int instance = 0; instance < MATRIX_INSTANCES_PER_SIZE; instance++)
+		{
+			unsigned seed = 1000 * cityCount + instance;
+			DistanceMatrix weights = randomWeights(cityCount, seed);
+			instances++;
+			mismatches += !checkInstance(MatrixDistance(weights), cityCount, "random weights", seed,
+			                             pathEndBranches);
+		}
+	}
+
+	cout << instances << " instances, " << mismatches << " disagreeing, " << pathEndBranches
+	     << " branches on path ends." << endl;
+	if(pathEndBranches == 0)
+	{
+		cout << "No instance branched on a path end; the check proves nothing." << endl;
+	}
+	return mismatches > 0 || pathEndBranches == 0 ? 1 : 0;
+}
@@ -0,0 +1,534 @@
+/******************************************************************************
+** Program name: executionPlanner.cpp
+** Class name: CS325-400
+** Author: Ben Fridkis
+** Date: 10/18/2026
+** Description: Memory budget planner. The programs used to always build
+**				their n^2 edge heaps and an n x n distance matrix, which
+**				does not fit in memory much beyond 10^4 cities, and to pick
+**				the 2-Opt variant by a fixed size (n <= 2500). Instead, the
+**				peak memory and running time of every combination of tour
+**				construction (edge heaps or candidate lists) and distance
+**				storage (full matrix, triangular matrix or on demand) is
+**				estimated from n. The original pipeline is kept whenever it
+**				fits in the memory limit and the time budget; otherwise the
+**				fastest combination that fits in the memory limit is used,
+**				with the slower, more thorough 2-Opt (restarting after each
+**				swap) when its estimated time fits in the time budget. The
+**				estimates are rough (constants measured on the unoptimized
+**				-g build), but they only need to rank the choices and get
+**				the order of magnitude right.
+*******************************************************************************/
+
+#include "executionPlanner.hpp"
+#include "threadPool.hpp"
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <algorithm>
+#include <unistd.h>
+using std::cout;
+using std::endl;
+using std::ifstream;
+using std::string;
+
+//Candidate list length (nearest neighbors kept per city).
+static const int CANDIDATES_PER_CITY = 8;
+
+//Memory not accounted for below (program, libraries, stack, allocator slack).
+static const double FIXED_OVERHEAD_BYTES = 32.0 * 1024 * 1024;
+
+//Bytes of bookkeeping per std::vector (the object plus its heap block header).
+static const double VECTOR_OVERHEAD_BYTES = 40;
+
+//Memory the bulk memory arena may hold beyond the arrays in it: the unused end
+//of the block being carved, and up to 2 MB of rounding per block of its own.
+static const double ARENA_SLACK_BYTES = 96.0 * 1024 * 1024;
+
+//The original pipeline restarted 2-Opt after each swap up to this many cities.
+static const int ORIGINAL_RESTART_CITIES = 2500;
+
+//Streaming distances stops at this many cities (a 2 GB triangular matrix)
+//whatever the plan. (A power of 2, see streamedDistanceBytes.)
+static const int LARGEST_STREAMED_CITIES = 32768;
+
+//Seconds per basic operation, measured on the default (unoptimized) build. (In
+//that build a matrix lookup, two non-inlined vector indexings, costs more than
+//computing a Euclidean distance; GEO's trigonometry costs far more.)
+static const double COORDINATE_DISTANCE_SECONDS = 7.5e-9;	//One EUC_2D, CEIL_2D or ATT distance
+static const double GEO_DISTANCE_SECONDS = 8e-8;			//One GEO distance
+static const double MATRIX_LOOKUP_SECONDS = 1e-8;			//One full matrix lookup
+static const double TRIANGULAR_LOOKUP_SECONDS = 1.2e-8;		//One triangular matrix lookup
+static const double HEAP_STEP_SECONDS = 1.5e-8;				//One sift step of a heap push or pop
+static const double CANDIDATE_SECONDS = 3e-7;				//Grid search work per candidate
+static const double SCAN_STEP_SECONDS = 2e-9;				//One element of a linear search
+
+//2-Opt work, in swap evaluations (4 lookups each): the single pass variant
+//sweeps the tour a few dozen times; the restarting variant rescans from the start
+//after each of its O(n) swaps.
+static const double SINGLE_PASS_SWEEPS = 25;
+static const double RESTART_EVALUATIONS_PER_N_CUBED = 0.3;
+
+//Steepest descent 2-Opt work: each city's best move is evaluated a few times
+//(2 * 2k moves of 4 lookups each), and the moves reverse about n / 8 cities each.
+static const double STEEPEST_EVALUATIONS_PER_CITY = 6;
+static const double STEEPEST_REVERSALS_PER_N_SQUARED = 0.1;
+
+//Reads a single number (a cgroup memory limit) from a file. Returns 0 if the
+//file is missing or holds "max" (no limit).
+static double readLimitFile(const char* fileName)
+{
+	ifstream file(fileName);
+	string value;
+	if(!(file >> value) || value == "max")
+	{
+		return 0;
+	}
+	return strtod(value.c_str(), nullptr);
+}
+
+/**************************************************************************************
+**                              availableMemoryBytes                                 **
+** Returns the memory the solver may use: physical memory, or the cgroup (container) **
+** memory limit if that is lower. cgroup v1 reports "no limit" as a huge number,     **
+** which the comparison with physical memory takes care of.                          **
+**************************************************************************************/
+double availableMemoryBytes()
+{
+	double bytes = static_cast<double>(sysconf(_SC_PHYS_PAGES)) * sysconf(_SC_PAGE_SIZE);
+	const char* limitFiles[] = {"/sys/fs/cgroup/memory.max",
+	                            "/sys/fs/cgroup/memory/memory.limit_in_bytes"};
+	for(int i = 0; i < 2; i++)
+	{
+		double limit = readLimitFile(limitFiles[i]);
+		if(limit > 0 && (bytes <= 0 || limit < bytes))
+		{
+			bytes = limit;
+		}
+	}
+	return bytes;
+}
+
+//Returns the seconds to compute one distance of the given metric (for EXPLICIT,
+//to read it from the instance's matrix).
+static double metricSeconds(EdgeWeightType edgeWeightType)
+{
+	if(edgeWeightType == EXPLICIT)
+	{
+		return MATRIX_LOOKUP_SECONDS;
+	}
+	return edgeWeightType == GEO ? GEO_DISTANCE_SECONDS : COORDINATE_DISTANCE_SECONDS;
+}
+
+//Returns the seconds per distance lookup for a distance storage.
+static double lookupSeconds(DistanceStorage storage, EdgeWeightType edgeWeightType)
+{
+	if(storage == FULL_MATRIX)
+	{
+		return MATRIX_LOOKUP_SECONDS;
+	}
+	return storage == TRIANGULAR_MATRIX ? TRIANGULAR_LOOKUP_SECONDS : metricSeconds(edgeWeightType);
+}
+
+/**************************************************************************************
+**                                 estimatePlan                                      **
+** Fills in estimatedBytes and estimatedSeconds for the plan's construction and      **
+** storage choices, and decides twoOptRestart (for the original pipeline, by its     **
+** fixed size). Returns the estimated seconds with single pass (or steepest descent) **
+** 2-Opt, by which plans are compared. Peak memory is the input and tour arrays,     **
+** plus the candidate lists if built, plus the larger of the construction phase      **
+** (whose heaps are freed before the distances are stored) and the improvement phase **
+** (distance storage, Held-Karp and annealing working arrays). A triangular matrix   **
+** computed while the input was read (distancesStreamed) is used as is or copied     **
+** into the full matrix, instead of computing the distances again.                   **
+**************************************************************************************/
+static double estimatePlan(ExecutionPlan& plan, int cityCount, EdgeWeightType edgeWeightType,
+                           ProgramConstructor programConstructor, const SolverOptions& options,
+                           bool distancesStreamed)
+{
+	double n = cityCount;
+	double k = plan.candidatesPerCity;
+	bool explicitWeights = edgeWeightType == EXPLICIT;
+	double distanceSeconds = metricSeconds(edgeWeightType);
+
+	//Input (cities, an EXPLICIT instance's matrix) and tour arrays.
+	double baseBytes = FIXED_OVERHEAD_BYTES + 24 * n + 12 * n;
+	if(options.bulkPages != STANDARD_ALLOCATOR)
+	{
+		baseBytes += ARENA_SLACK_BYTES;
+	}
+	if(explicitWeights)
+	{
+		baseBytes += n * (4 * n + VECTOR_OVERHEAD_BYTES);
+	}
+	double candidateBytes = plan.needsCandidates ? n * (4 * k + VECTOR_OVERHEAD_BYTES) : 0;
+	double seconds = 0;
+	if(plan.needsCandidates)
+	{
+		//(EXPLICIT and GEO candidates come from an O(n^2) scan, the others from
+		//the spatial grid.)
+		seconds += explicitWeights || edgeWeightType == GEO ? n * n * distanceSeconds * std::log2(k + 1) :
+		                             n * k * CANDIDATE_SECONDS;
+	}
+
+	//Construction. (The edge heaps read a streamed matrix if the plan keeps it.)
+	double constructionBytes = 0;
+	double heapDistanceSeconds = distancesStreamed && plan.distanceStorage != ON_DEMAND ?
+	                             TRIANGULAR_LOOKUP_SECONDS : distanceSeconds;
+	if(options.tourConstructor == HILBERT_CONSTRUCTOR)
+	{
+		constructionBytes = 16 * n;
+		seconds += n * std::log2(n + 1) * HEAP_STEP_SECONDS;
+	}
+	else if(options.tourConstructor == CHEAPEST_INSERTION_CONSTRUCTOR ||
+	        options.tourConstructor == FARTHEST_INSERTION_CONSTRUCTOR)
+	{
+		//Tour links, the heap and the spatial grid (and, for cheapest insertion,
+		//reversed candidate lists). Evaluating an insertion costs 6 distances per
+		//tour city on the candidate list; cheapest insertion reevaluates the 3k
+		//cities listing the inserted city or its two tour neighbors.
+		constructionBytes = 96 * n;
+		if(options.tourConstructor == CHEAPEST_INSERTION_CONSTRUCTOR)
+		{
+			constructionBytes += n * (4 * k + VECTOR_OVERHEAD_BYTES);
+			seconds += 3 * n * k * (6 * k * distanceSeconds + std::log2(3 * n * k + 1) * HEAP_STEP_SECONDS);
+		}
+		else
+		{
+			seconds += n * (6 * k * distanceSeconds + CANDIDATE_SECONDS +
+			                std::log2(n + 1) * HEAP_STEP_SECONDS);
+		}
+	}
+	else if(options.tourConstructor == PARALLEL_GREEDY_CONSTRUCTOR)
+	{
+		//Each candidate edge is listed at both of its cities; sorting the lists
+		//is split among the cores.
+		constructionBytes = 24 * n * k + n * (2 * VECTOR_OVERHEAD_BYTES + 96);
+		seconds += 2 * n * k * (distanceSeconds + std::log2(2 * k + 1) * HEAP_STEP_SECONDS) /
+		           ThreadPool::defaultThreadCount();
+	}
+	else if(plan.candidateConstruction)
+	{
+		//Candidate edges, union-find/tour arrays and the spatial grid.
+		constructionBytes = 12 * n * k + 64 * n;
+		seconds += n * k * std::log2(n * k + 1) * HEAP_STEP_SECONDS;
+	}
+	else if(programConstructor == GREEDY_EDGE_HEAP)
+	{
+		//n^2 edges of 12 bytes; about half of them are popped before the tour closes.
+		constructionBytes = 12 * n * n;
+		seconds += n * n * (heapDistanceSeconds + 0.5 * std::log2(n * n + 1) * HEAP_STEP_SECONDS);
+	}
+	else
+	{
+		//n heaps of n edges of 8 bytes. The walk checks each popped city against
+		//the tour so far with a linear search, about n^3 / 8 steps in all.
+		constructionBytes = n * (8 * n + VECTOR_OVERHEAD_BYTES);
+		seconds += n * n * (heapDistanceSeconds + HEAP_STEP_SECONDS) +
+		           0.125 * n * n * n * SCAN_STEP_SECONDS;
+	}
+
+	//Distance storage.
+	double storageBytes = 0;
+	if(plan.distanceStorage == FULL_MATRIX)
+	{
+		storageBytes = n * (4 * n + VECTOR_OVERHEAD_BYTES);
+		if(distancesStreamed)
+		{
+			//(Copied out of the streamed triangle, which is freed afterwards.)
+			storageBytes += 2 * n * n;
+			seconds += n * n * TRIANGULAR_LOOKUP_SECONDS;
+		}
+		else
+		{
+			seconds += n * n * distanceSeconds;
+		}
+	}
+	else if(plan.distanceStorage == TRIANGULAR_MATRIX)
+	{
+		storageBytes = 2 * n * n;
+		if(!distancesStreamed)
+		{
+			seconds += 0.5 * n * n * distanceSeconds;
+		}
+	}
+
+	//Improvement: Held-Karp adjacency and arrays, annealing replicas, merging.
+	double improvementBytes = 0;
+	double lookup = lookupSeconds(plan.distanceStorage, edgeWeightType);
+	if(options.computeHeldKarpBound)
+	{
+		improvementBytes = std::max(improvementBytes, n * (8 * k + VECTOR_OVERHEAD_BYTES) + 48 * n);
+		seconds += n * n * lookup;		//(The final dense 1-tree.)
+	}
+	if(options.annealSeconds > 0)
+	{
+		double replicas = options.replicaCount > 0 ? options.replicaCount : 64;
+		improvementBytes = std::max(improvementBytes, (replicas + 2 * options.independentRuns) * 8 * n);
+		seconds += options.annealSeconds;
+	}
+	if(!options.mergeTourFiles.empty())
+	{
+		improvementBytes = std::max(improvementBytes,
+		                            (options.mergeTourFiles.size() + 1) * 12 * n + 64 * n);
+	}
+
+	//2-Opt: steepest descent if asked for (its queue and two-way candidate lists
+	//live alongside the distances); otherwise single pass unless the restarting
+	//variant fits in the time budget.
+	double comparedSeconds;
+	if(options.twoOptMode == BEST_IMPROVEMENT)
+	{
+		improvementBytes = std::max(improvementBytes, n * (8 * k + VECTOR_OVERHEAD_BYTES) + 48 * n);
+		plan.twoOptRestart = false;
+		plan.estimatedSeconds = seconds + STEEPEST_EVALUATIONS_PER_CITY * n * 4 * k * 4 * lookup +
+		                        STEEPEST_REVERSALS_PER_N_SQUARED * n * n * SCAN_STEP_SECONDS;
+		comparedSeconds = plan.estimatedSeconds;
+	}
+	else
+	{
+		double singlePassSeconds = SINGLE_PASS_SWEEPS * 0.5 * n * n * 4 * lookup;
+		double restartSeconds = RESTART_EVALUATIONS_PER_N_CUBED * n * n * n * 4 * lookup;
+		plan.twoOptRestart = plan.originalPipeline ? cityCount <= ORIGINAL_RESTART_CITIES :
+		                     seconds + restartSeconds <= options.timeBudgetSeconds;
+		plan.estimatedSeconds = seconds + (plan.twoOptRestart ? restartSeconds : singlePassSeconds);
+		comparedSeconds = seconds + singlePassSeconds;
+	}
+
+	if(distancesStreamed && plan.distanceStorage != ON_DEMAND)
+	{
+		constructionBytes += 2 * n * n;		//(The streamed triangle, kept through construction.)
+	}
+	plan.estimatedBytes = baseBytes + candidateBytes +
+	                      std::max(constructionBytes, storageBytes + improvementBytes);
+	plan.fitsInMemory = plan.estimatedBytes <= plan.memoryLimitBytes;
+	return comparedSeconds;
+}
+
+//Returns whether the options leave the original pipeline possible (no construction
+//other than the edge heaps forced, first improvement 2-Opt).
+static bool originalPipelineAllowed(const SolverOptions& options)
+{
+	return options.twoOptMode == FIRST_IMPROVEMENT && (options.tourConstructor == PROGRAM_CONSTRUCTOR ||
+	                                                   options.tourConstructor == EDGE_HEAP_CONSTRUCTOR);
+}
+
+//Returns the plan for one combination of construction and distance storage, with
+//its estimates (see estimatePlan, whose return value is written to seconds).
+static ExecutionPlan combinationPlan(bool originalPipeline, bool candidateConstruction,
+                                     DistanceStorage storage, int cityCount,
+                                     EdgeWeightType edgeWeightType, ProgramConstructor programConstructor,
+                                     const SolverOptions& options, bool distancesStreamed, double& seconds)
+{
+	ExecutionPlan plan;
+	plan.originalPipeline = originalPipeline;
+	plan.candidateConstruction = candidateConstruction;
+	plan.distanceStorage = storage;
+	plan.candidatesPerCity = CANDIDATES_PER_CITY;
+	plan.needsCandidates = (plan.candidateConstruction &&
+	                        options.tourConstructor != HILBERT_CONSTRUCTOR) ||
+	                       options.tourConstructor == CHEAPEST_INSERTION_CONSTRUCTOR ||
+	                       options.tourConstructor == FARTHEST_INSERTION_CONSTRUCTOR ||
+	                       options.tourConstructor == PARALLEL_GREEDY_CONSTRUCTOR ||
+	                       options.twoOptMode == BEST_IMPROVEMENT ||
+	                       options.computeHeldKarpBound || options.annealSeconds > 0;
+	plan.memoryLimitBytes = options.memoryLimitBytes > 0 ? options.memoryLimitBytes :
+	                        availableMemoryBytes();
+	seconds = estimatePlan(plan, cityCount, edgeWeightType, programConstructor, options,
+	                       distancesStreamed);
+	return plan;
+}
+
+/**************************************************************************************
+**                                 planExecution                                     **
+** Returns the programs' original pipeline (the edge heaps, a full matrix, and 2-Opt **
+** restarting after each swap up to ORIGINAL_RESTART_CITIES cities) if it fits in    **
+** the memory limit (--memory-limit, or availableMemoryBytes() if not given) and its **
+** estimate fits in --time-budget. Otherwise every combination of construction and   **
+** distance storage is estimated and the fastest one that fits in the memory limit   **
+** is returned. If none fits, the one needing the least memory is returned, with     **
+** fitsInMemory false. A construction forced with --constructor is kept. An EXPLICIT **
+** instance already holds its full matrix, so its distances are always read from it  **
+** (ON_DEMAND, no copy). distancesStreamed means a triangular matrix was computed    **
+** while reading the input.                                                          **
+**************************************************************************************/
+ExecutionPlan planExecution(int cityCount, EdgeWeightType edgeWeightType,
+                            ProgramConstructor programConstructor, const SolverOptions& options,
+                            bool distancesStreamed)
+{
+	double seconds;
+	if(originalPipelineAllowed(options))
+	{
+		DistanceStorage storage = edgeWeightType == EXPLICIT ? ON_DEMAND : FULL_MATRIX;
+		ExecutionPlan original = combinationPlan(true, false, storage, cityCount, edgeWeightType,
+		                                         programConstructor, options, distancesStreamed, seconds);
+		if(original.fitsInMemory && original.estimatedSeconds <= options.timeBudgetSeconds)
+		{
+			return original;
+		}
+	}
+
+	ExecutionPlan best;
+	double bestSeconds = 0;
+	bool haveBest = false;
+	for(int construction = 0; construction < 2; construction++)
+	{
+		if((construction == 0 && options.tourConstructor == CANDIDATE_CONSTRUCTOR) ||
+		   (construction == 1 && options.tourConstructor == EDGE_HEAP_CONSTRUCTOR))
+		{
+			continue;
+		}
+		for(int storage = FULL_MATRIX; storage <= ON_DEMAND; storage++)
+		{
+			if(edgeWeightType == EXPLICIT && storage != ON_DEMAND)
+			{
+				continue;
+			}
+			ExecutionPlan plan = combinationPlan(false, construction == 1,
+			                                     static_cast<DistanceStorage>(storage), cityCount,
+			                                     edgeWeightType, programConstructor, options,
+			                                     distancesStreamed, seconds);
+
+			bool better;
+			if(!haveBest)
+			{
+				better = true;
+			}
+			else if(plan.fitsInMemory != best.fitsInMemory)
+			{
+				better = plan.fitsInMemory;
+			}
+			else if(plan.fitsInMemory)
+			{
+				better = seconds < bestSeconds;
+			}
+			else
+			{
+				better = plan.estimatedBytes < best.estimatedBytes;
+			}
+			if(better)
+			{
+				best = plan;
+				bestSeconds = seconds;
+				haveBest = true;
+			}
+		}
+	}
+	return best;
+}
+
+//Returns whether planExecution, given cityCount cities streamed with their
+//distances, stores the distances in a matrix.
+static bool storesDistances(int cityCount, EdgeWeightType edgeWeightType,
+                            ProgramConstructor programConstructor, const SolverOptions& options)
+{
+	ExecutionPlan plan = planExecution(cityCount, edgeWeightType, programConstructor, options, true);
+	return plan.fitsInMemory && plan.distanceStorage != ON_DEMAND;
+}
+
+/**************************************************************************************
+**                              streamedDistanceBytes                                **
+** Returns how many bytes of triangular distance matrix are worth computing while    **
+** the input is still being read (see cityStream.cpp), or 0 if none. The number of   **
+** cities is not known yet, so this is the matrix of the largest instance for which  **
+** planExecution would store the distances (a full or triangular matrix), found by   **
+** doubling and then bisecting the city count; the streamed matrix is dropped once   **
+** the input grows past it. Renumbering the cities after loading would put the       **
+** streamed rows out of order, and an EXPLICIT instance already holds its matrix.    **
+**************************************************************************************/
+double streamedDistanceBytes(EdgeWeightType edgeWeightType, ProgramConstructor programConstructor,
+                             const SolverOptions& options)
+{
+	if(edgeWeightType == EXPLICIT || options.renumbering != NO_RENUMBERING ||
+	   !storesDistances(2, edgeWeightType, programConstructor, options))
+	{
+		return 0;
+	}
+	int stored = 2, notStored = 4;
+	while(stored < LARGEST_STREAMED_CITIES &&
+	      storesDistances(notStored, edgeWeightType, programConstructor, options))
+	{
+		stored = notStored;
+		notStored *= 2;
+	}
+	while(stored < LARGEST_STREAMED_CITIES && notStored - stored > 1)
+	{
+		int middle = stored + (notStored - stored) / 2;
+		if(storesDistances(middle, edgeWeightType, programConstructor, options))
+		{
+			stored = middle;
+		}
+		else
+		{
+			notStored = middle;
+		}
+	}
+	return 2.0 * stored * (stored - 1);
+}
+
+//Formats a byte count for printExecutionPlan.
+static string formatBytes(double bytes)
+{
+	const char* units[] = {"B", "KB", "MB", "GB", "TB"};
+	int unit = 0;
+	while(bytes >= 1024 && unit < 4)
+	{
+		bytes /= 1024;
+		unit++;
+	}
+	char text[32];
+	snprintf(text, sizeof(text), "%.1f %s", bytes, units[unit]);
+	return text;
+}
+
+//Prints the plan (one "Plan:" line, saying whether it is the original pipeline,
+//plus a warning if nothing fit).
+void printExecutionPlan(const ExecutionPlan& plan, ProgramConstructor programConstructor,
+                        const SolverOptions& options)
+{
+	string construction;
+	if(options.tourConstructor == HILBERT_CONSTRUCTOR)
+	{
+		construction = "Hilbert curve tour";
+	}
+	else if(options.tourConstructor == CHEAPEST_INSERTION_CONSTRUCTOR)
+	{
+		construction = "cheapest insertion tour";
+	}
+	else if(options.tourConstructor == FARTHEST_INSERTION_CONSTRUCTOR)
+	{
+		construction = "farthest insertion tour";
+	}
+	else if(options.tourConstructor == PARALLEL_GREEDY_CONSTRUCTOR)
+	{
+		construction = "parallel greedy tour from candidate lists";
+	}
+	else if(plan.candidateConstruction)
+	{
+		construction = programConstructor == GREEDY_EDGE_HEAP ? "greedy" : "nearest neighbor";
+		construction += " tour from candidate lists";
+	}
+	else
+	{
+		construction = programConstructor == GREEDY_EDGE_HEAP ? "greedy tour from the edge heap" :
+		                                                        "nearest neighbor tour from the edge heaps";
+	}
+	const char* storage = plan.distanceStorage == FULL_MATRIX ? "full distance matrix" :
+	                      plan.distanceStorage == TRIANGULAR_MATRIX ? "triangular distance matrix" :
+	                      "distances on demand";
+	cout << "Plan: " << construction << ", " << storage << ", "
+	     << (options.twoOptMode == BEST_IMPROVEMENT ? "steepest descent 2-Opt" :
+	         plan.twoOptRestart ? "2-Opt restarting after each swap" : "single pass 2-Opt") << endl
+	     << "      (estimated " << formatBytes(plan.estimatedBytes) << " of "
+	     << formatBytes(plan.memoryLimitBytes) << " available, about "
+	     << std::max(1.0, std::ceil(plan.estimatedSeconds)) << " s"
+	     << (plan.originalPipeline ? ", the original pipeline)" :
+	         originalPipelineAllowed(options) ? "; the original pipeline is over budget)" : ")") << endl;
+	if(!plan.fitsInMemory)
+	{
+		cout << "Warning: no plan fits in the memory limit; using the smallest." << endl;
+	}
+}
@@ -0,0 +1,60 @@
+/******************************************************************************
+** Program name: executionPlanner.hpp
+** Class name: CS325-400
+** Author: Ben Fridkis
+** Date: 10/18/2026
+** Description: Declarations for the planner that chooses, from the number
+**				of cities and the memory available, how the solver stores
+**				distances and builds its initial tour.
+*******************************************************************************/
+
+#ifndef EXECUTION_PLANNER_HPP
+#define EXECUTION_PLANNER_HPP
+
+#include "solverOptions.hpp"
+#include "tspMetrics.hpp"
+
+//How 2-Opt (and the steps after it) look up distances.
+enum DistanceStorage{
+	FULL_MATRIX,		//n x n matrix (loadGraphOfMapAsVectors)
+	TRIANGULAR_MATRIX,	//Lower triangle only (TriangularMatrixDistance)
+	ON_DEMAND			//Computed from the coordinates (or read from an EXPLICIT
+						//instance's own matrix) at every lookup
+};
+
+//The initial tour construction of the program doing the planning.
+enum ProgramConstructor{
+	GREEDY_EDGE_HEAP,		//greedyTSP_w2Opt: one heap holding all n^2 edges
+	NEAREST_NEIGHBOR_HEAPS	//nearestNeighborTSP_w2Opt: one heap of n edges per city
+};
+
+//The planner's decisions, with the estimates they were based on.
+struct ExecutionPlan{
+	bool originalPipeline;			//The programs' original pipeline: edge heaps, full
+									//matrix, restarting 2-Opt up to ORIGINAL_RESTART_CITIES
+	bool candidateConstruction;		//Build the tour from candidate lists (candidateTours.cpp)
+									//instead of the program's edge heaps
+	DistanceStorage distanceStorage;
+	bool twoOptRestart;				//Restart the 2-Opt scan after every swap (see twoOptImprove)
+	bool needsCandidates;			//Candidate lists are built (construction, bound or annealing)
+	int candidatesPerCity;
+	double estimatedBytes;
+	double estimatedSeconds;
+	double memoryLimitBytes;
+	bool fitsInMemory;
+};
+
+double availableMemoryBytes();
+
+//(Checked on plain EUC_2D input by streamingCheck.cpp.)
+double streamedDistanceBytes(EdgeWeightType edgeWeightType, ProgramConstructor programConstructor,
+                             const SolverOptions& options);
+
+ExecutionPlan planExecution(int cityCount, EdgeWeightType edgeWeightType,
+                            ProgramConstructor programConstructor, const SolverOptions& options,
+                            bool distancesStreamed);
+
+void printExecutionPlan(const ExecutionPlan& plan, ProgramConstructor programConstructor,
+                        const SolverOptions& options);
+
+#endif
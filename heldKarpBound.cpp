@@ -0,0 +1,415 @@
+/******************************************************************************
+** Program name: heldKarpBound.cpp
+** Class name: CS325-400
+** Author: Ben Fridkis
+** Date: 10/18/2026
+** Description: Held-Karp lower bound by subgradient optimization of
+**				minimum 1-trees (Held & Karp, 1970/1971; see also
+**				https://web.tuke.sk/fei-cit/butka/hop/htsp.pdf).
+**				The ascent builds its minimum spanning trees from the
+**				candidate (nearest neighbor) lists only, joined into one
+**				component where they fall apart, which is what makes it
+**				affordable. The final bound is evaluated once on the
+**				complete graph so that the value reported is a true lower
+**				bound.
+*******************************************************************************/
+
+#include "heldKarpBound.hpp"
+#include "tspMetrics.hpp"
+#include <vector>
+#include <queue>
+#include <algorithm>
+#include <functional>
+#include <utility>
+#include <limits>
+#include <cmath>
+using std::vector;
+using std::priority_queue;
+using std::pair;
+using std::make_pair;
+using std::greater;
+using std::nth_element;
+using std::sort;
+
+//Returns the "penalized" length of the edge between cities a and b.
+template <class Distance>
+static inline double penalized(const Distance& graph, const vector<double>& pi,
+                               int a, int b)
+{
+	return graph(a, b) + pi[a] + pi[b];
+}
+
+/**************************************************************************************
+**                               buildCandidateLists                                 **
+** This function returns, for each city, the (up to) candidatesPerCity closest other **
+** cities in order of increasing distance. These lists are the sparse graph that the **
+** 1-tree ascent works on.                                                           **
+**************************************************************************************/
+template <class Distance>
+vector<vector<int>> buildCandidateLists(int cityCount, const Distance& distance, int candidatesPerCity)
+{
+	int k = std::min(candidatesPerCity, cityCount - 1);
+	vector<vector<int>> candidates(cityCount);
+	if(k <= 0)
+	{
+		return candidates;
+	}
+
+	vector<int> others;
+	for(int i = 0; i < cityCount; i++)
+	{
+		others.clear();
+		for(int j = 0; j < cityCount; j++)
+		{
+			if(j != i)
+			{
+				others.push_back(j);
+			}
+		}
+		nth_element(others.begin(), others.begin() + (k - 1), others.end(),
+		            [&distance, i](int a, int b) { return distance(i, a) < distance(i, b); });
+		sort(others.begin(), others.begin() + k,
+		     [&distance, i](int a, int b) { return distance(i, a) < distance(i, b); });
+		candidates[i].assign(others.begin(), others.begin() + k);
+	}
+	return candidates;
+}
+
+/**************************************************************************************
+**                                 sparseOneTree                                     **
+** Computes the minimum 1-tree (minimum spanning tree on cities 1..n-1, plus the two **
+** shortest edges to city 0) using only the edges in the adjacency lists, with each  **
+** edge length penalized by pi. The degree of each city in the 1-tree is written to  **
+** degree. The adjacency lists must connect cities 1..n-1 (see connectAdjacency).    **
+**************************************************************************************/
+template <class Distance>
+static void sparseOneTree(const Distance& graph, const vector<vector<int>>& adjacency,
+                          const vector<double>& pi, vector<int>& degree, double& length)
+{
+	int cityCount = static_cast<int>(pi.size());
+	const double infinity = std::numeric_limits<double>::infinity();
+	vector<double> key(cityCount, infinity);
+	vector<int> parent(cityCount, -1);
+	vector<bool> inTree(cityCount, false);
+	priority_queue<pair<double, int>, vector<pair<double, int>>, greater<pair<double, int>>> heap;
+
+	std::fill(degree.begin(), degree.end(), 0);
+	length = 0;
+	key[1] = 0;
+	heap.push(make_pair(0.0, 1));
+	while(!heap.empty())
+	{
+		int city = heap.top().second;
+		heap.pop();
+		if(inTree[city])
+		{
+			continue;	//(Stale heap entry.)
+		}
+		inTree[city] = true;
+		if(parent[city] != -1)
+		{
+			length += key[city];
+			degree[city]++;
+			degree[parent[city]]++;
+		}
+		for(int j = 0; j < static_cast<int>(adjacency[city].size()); j++)
+		{
+			int next = adjacency[city][j];
+			double w = penalized(graph, pi, city, next);
+			if(!inTree[next] && w < key[next])
+			{
+				key[next] = w;
+				parent[next] = city;
+				heap.push(make_pair(w, next));
+			}
+		}
+	}
+	//Attach city 0 by its two shortest (penalized) edges.
+	int first = -1, second = -1;
+	for(int j = 1; j < cityCount; j++)
+	{
+		double w = penalized(graph, pi, 0, j);
+		if(first == -1 || w < penalized(graph, pi, 0, first))
+		{
+			second = first;
+			first = j;
+		}
+		else if(second == -1 || w < penalized(graph, pi, 0, second))
+		{
+			second = j;
+		}
+	}
+	length += penalized(graph, pi, 0, first) + penalized(graph, pi, 0, second);
+	degree[0] = 2;
+	degree[first]++;
+	degree[second]++;
+}
+
+/**************************************************************************************
+**                                  denseOneTree                                     **
+** Same as sparseOneTree, but considers every edge of the (complete) graph using the **
+** O(n^2) array version of Prim's algorithm. Always succeeds.                        **
+**************************************************************************************/
+template <class Distance>
+static void denseOneTree(const Distance& graph, const vector<double>& pi,
+                         vector<int>& degree, double& length)
+{
+	int cityCount = static_cast<int>(pi.size());
+	const double infinity = std::numeric_limits<double>::infinity();
+	vector<double> key(cityCount, infinity);
+	vector<int> parent(cityCount, -1);
+	vector<bool> inTree(cityCount, false);
+
+	std::fill(degree.begin(), degree.end(), 0);
+	length = 0;
+	key[1] = 0;
+	for(int added = 0; added < cityCount - 1; added++)
+	{
+		int city = -1;
+		for(int j = 1; j < cityCount; j++)
+		{
+			if(!inTree[j] && (city == -1 || key[j] < key[city]))
+			{
+				city = j;
+			}
+		}
+		inTree[city] = true;
+		if(parent[city] != -1)
+		{
+			length += key[city];
+			degree[city]++;
+			degree[parent[city]]++;
+		}
+		for(int j = 1; j < cityCount; j++)
+		{
+			double w = penalized(graph, pi, city, j);
+			if(!inTree[j] && w < key[j])
+			{
+				key[j] = w;
+				parent[j] = city;
+			}
+		}
+	}
+
+	int first = -1, second = -1;
+	for(int j = 1; j < cityCount; j++)
+	{
+		double w = penalized(graph, pi, 0, j);
+		if(first == -1 || w < penalized(graph, pi, 0, first))
+		{
+			second = first;
+			first = j;
+		}
+		else if(second == -1 || w < penalized(graph, pi, 0, second))
+		{
+			second = j;
+		}
+	}
+	length += penalized(graph, pi, 0, first) + penalized(graph, pi, 0, second);
+	degree[0] = 2;
+	degree[first]++;
+	degree[second]++;
+}
+
+/**************************************************************************************
+**                               connectAdjacency                                    **
+** The nearest neighbor lists of clustered cities often leave each cluster on its    **
+** own, so that no spanning tree exists in them. This function finds the components  **
+** of the adjacency lists (cities 1..n-1) and, if there is more than one, adds the   **
+** edges of a minimum spanning tree of the graph whose nodes are the components:     **
+** each city joins the tree together with its whole component, and only the edges    **
+** between components are kept. This takes O(n^2) time, once, and only for           **
+** disconnected lists.                                                               **
+**************************************************************************************/
+template <class Distance>
+static void connectAdjacency(const Distance& graph, vector<vector<int>>& adjacency)
+{
+	int cityCount = static_cast<int>(adjacency.size());
+	vector<int> component(cityCount, -1);
+	vector<vector<int>> members;
+	for(int i = 1; i < cityCount; i++)
+	{
+		if(component[i] != -1)
+		{
+			continue;
+		}
+		int id = static_cast<int>(members.size());
+		members.push_back(vector<int>(1, i));
+		component[i] = id;
+		for(int m = 0; m < static_cast<int>(members[id].size()); m++)
+		{
+			int city = members[id][m];
+			for(int j = 0; j < static_cast<int>(adjacency[city].size()); j++)
+			{
+				int next = adjacency[city][j];
+				if(component[next] == -1)
+				{
+					component[next] = id;
+					members[id].push_back(next);
+				}
+			}
+		}
+	}
+	if(members.size() < 2)
+	{
+		return;
+	}
+
+	//Prim's algorithm over the cities, adding a city's whole component at once.
+	const double infinity = std::numeric_limits<double>::infinity();
+	vector<double> key(cityCount, infinity);
+	vector<int> parent(cityCount, -1);
+	vector<bool> inTree(cityCount, false);
+	int joiner = 1;
+	for(int joined = 0; joined < static_cast<int>(members.size()); joined++)
+	{
+		if(parent[joiner] != -1)
+		{
+			adjacency[joiner].push_back(parent[joiner]);
+			adjacency[parent[joiner]].push_back(joiner);
+		}
+		const vector<int>& added = members[component[joiner]];
+		for(int m = 0; m < static_cast<int>(added.size()); m++)
+		{
+			inTree[added[m]] = true;
+		}
+		for(int m = 0; m < static_cast<int>(added.size()); m++)
+		{
+			for(int j = 1; j < cityCount; j++)
+			{
+				double w = graph(added[m], j);
+				if(!inTree[j] && w < key[j])
+				{
+					key[j] = w;
+					parent[j] = added[m];
+				}
+			}
+		}
+		joiner = -1;
+		for(int j = 1; j < cityCount; j++)
+		{
+			if(!inTree[j] && (joiner == -1 || key[j] < key[joiner]))
+			{
+				joiner = j;
+			}
+		}
+	}
+}
+
+/**************************************************************************************
+**                              computeHeldKarpBound                                 **
+** This function returns the Held-Karp lower bound on the optimal tour length. The   **
+** city penalties (pi) are adjusted by subgradient optimization: cities with degree  **
+** greater than 2 in the current minimum 1-tree are made more expensive, cities with **
+** degree 1 cheaper, until the 1-tree is (nearly) a tour. The step size follows the  **
+** usual Held-Karp rule t = lambda * (upperBound - L) / |d - 2|^2, where upperBound  **
+** is the length of any known tour (e.g. the constructed tour). Lambda is halved     **
+** whenever the bound stops improving.                                               **
+**************************************************************************************/
+template <class Distance>
+int computeHeldKarpBound(int cityCount, const Distance& graph, const vector<vector<int>>& candidates,
+                         int upperBound)
+{
+	if(cityCount < 3)
+	{
+		return upperBound;	//(With fewer than 3 cities the only tour is optimal.)
+	}
+
+	//The candidate lists are made symmetric (if j is a candidate of i, i is made a
+	//candidate of j) and city 0 is left out, since it is handled separately.
+	vector<vector<int>> adjacency(cityCount);
+	for(int i = 1; i < cityCount; i++)
+	{
+		for(int j = 0; j < static_cast<int>(candidates[i].size()); j++)
+		{
+			int c = candidates[i][j];
+			if(c != 0)
+			{
+				adjacency[i].push_back(c);
+				adjacency[c].push_back(i);
+			}
+		}
+	}
+	for(int i = 1; i < cityCount; i++)
+	{
+		sort(adjacency[i].begin(), adjacency[i].end());
+		adjacency[i].erase(std::unique(adjacency[i].begin(), adjacency[i].end()),
+		                   adjacency[i].end());
+	}
+	connectAdjacency(graph, adjacency);
+
+	vector<double> pi(cityCount, 0), bestPi(cityCount, 0);
+	vector<int> degree(cityCount);
+	double bestLength = -std::numeric_limits<double>::infinity();
+	double lambda = 2.0;
+	const int maxIterations = 1000;
+	const int patience = std::max(10, std::min(cityCount / 10, 50));
+	int sinceImprovement = 0;
+
+	for(int iteration = 0; iteration < maxIterations && lambda > 1e-4; iteration++)
+	{
+		double length;
+		sparseOneTree(graph, adjacency, pi, degree, length);
+		double piSum = 0;
+		for(int i = 0; i < cityCount; i++)
+		{
+			piSum += pi[i];
+		}
+		length -= 2 * piSum;
+
+		if(length > bestLength + 1e-9)
+		{
+			bestLength = length;
+			bestPi = pi;
+			sinceImprovement = 0;
+		}
+		else if(++sinceImprovement >= patience)
+		{
+			lambda /= 2;
+			sinceImprovement = 0;
+		}
+
+		long long normSquared = 0;
+		for(int i = 0; i < cityCount; i++)
+		{
+			normSquared += static_cast<long long>(degree[i] - 2) * (degree[i] - 2);
+		}
+		if(normSquared == 0 || length >= upperBound)
+		{
+			break;		//(The 1-tree is a tour, so no better bound exists.)
+		}
+
+		double step = lambda * (upperBound - length) / normSquared;
+		for(int i = 0; i < cityCount; i++)
+		{
+			pi[i] += step * (degree[i] - 2);
+		}
+	}
+
+	//The ascent only looked at candidate edges, so the best penalties are evaluated
+	//once more over the complete graph to obtain a valid bound.
+	double length;
+	denseOneTree(graph, bestPi, degree, length);
+	for(int i = 0; i < cityCount; i++)
+	{
+		length -= 2 * bestPi[i];
+	}
+	int bound = static_cast<int>(std::ceil(length - 1e-6));
+	return std::min(bound, upperBound);
+}
+
+//Returns how far (in percent) tourDistance is above lowerBound.
+double optimalityGapPercent(int tourDistance, int lowerBound)
+{
+	if(lowerBound <= 0)
+	{
+		return 0;
+	}
+	return 100.0 * (tourDistance - lowerBound) / lowerBound;
+}
+
+//(See FOR_EACH_DISTANCE_SOURCE in tspMetrics.hpp.)
+#define INSTANTIATE_HELD_KARP(Distance) \
+	template vector<vector<int>> buildCandidateLists<Distance>(int, const Distance&, int); \
+	template int computeHeldKarpBound<Distance>(int, const Distance&, const vector<vector<int>>&, int);
+FOR_EACH_DISTANCE_SOURCE(INSTANTIATE_HELD_KARP)
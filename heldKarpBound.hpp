@@ -0,0 +1,29 @@
+/******************************************************************************
+** Program name: heldKarpBound.hpp
+** Class name: CS325-400
+** Author: Ben Fridkis
+** Date: 10/18/2026
+** Description: Declarations for the Held-Karp (1-tree) lower bound, used to
+**				report how far a tour is from optimal and to stop tour
+**				improvement early once a target gap is reached.
+*******************************************************************************/
+
+#ifndef HELD_KARP_BOUND_HPP
+#define HELD_KARP_BOUND_HPP
+
+#include <vector>
+
+//(The templates are defined in heldKarpBound.cpp for each distance source in
+//tspMetrics.hpp.)
+template <class Distance>
+std::vector<std::vector<int>> buildCandidateLists(int cityCount, const Distance& distance,
+                                                  int candidatesPerCity);
+
+template <class Distance>
+int computeHeldKarpBound(int cityCount, const Distance& graph,
+                         const std::vector<std::vector<int>>& candidates,
+                         int upperBound);
+
+double optimalityGapPercent(int tourDistance, int lowerBound);
+
+#endif
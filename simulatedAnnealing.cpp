@@ -0,0 +1,361 @@
+/******************************************************************************
+** Program name: simulatedAnnealing.cpp
+** Class name: CS325-400
+** Author: Ben Fridkis
+** Date: 10/18/2026
+** Description: Simulated annealing with parallel tempering (replica
+**				exchange). 2-Opt (twoOptImprove) only accepts improving
+**				swaps, so it stops at the first local optimum. Here, several
+**				replicas of the tour are annealed at once, one per worker
+**				thread, each at a fixed temperature from a geometric ladder.
+**				Hot replicas wander, cold replicas refine, and neighboring
+**				replicas periodically swap tours so that good tours found
+**				hot are carried down to be refined. Moves are 2-Opt and
+**				Or-Opt (segment of 1-3 cities moved elsewhere), both drawn
+**				from the candidate (nearest neighbor) lists, with O(1) delta
+**				evaluation. See https://en.wikipedia.org/wiki/Parallel_tempering.
+*******************************************************************************/
+
+#include "simulatedAnnealing.hpp"
+#include "threadPool.hpp"
+#include "tourMerging.hpp"
+#include "tspMetrics.hpp"
+#include <vector>
+#include <tuple>
+#include <random>
+#include <chrono>
+#include <cmath>
+#include <algorithm>
+using std::vector;
+using std::tuple;
+using std::get;
+using std::mt19937;
+
+//One annealing replica. The tour is stored with the position of each city so
+//that the successor of any city can be found in O(1). (Both are bulk arrays, see
+//bulkMemory.cpp.)
+struct Replica{
+	BulkVector<int> tour;
+	BulkVector<int> position;
+	int distance;
+	double temperature;
+	mt19937 random;
+};
+
+static inline int successor(const Replica& r, int city)
+{
+	int n = static_cast<int>(r.tour.size());
+	return r.tour[(r.position[city] + 1) % n];
+}
+
+static inline int predecessor(const Replica& r, int city)
+{
+	int n = static_cast<int>(r.tour.size());
+	return r.tour[(r.position[city] + n - 1) % n];
+}
+
+//Metropolis criterion: improving moves are always accepted, worsening moves
+//with probability e^(-delta / temperature).
+static inline bool accept(Replica& r, int delta)
+{
+	if(delta <= 0)
+	{
+		return true;
+	}
+	std::uniform_real_distribution<double> uniform(0.0, 1.0);
+	return uniform(r.random) < std::exp(-delta / r.temperature);
+}
+
+/**************************************************************************************
+**                                  reversePath                                      **
+** Reverses the cities at tour positions from..to (inclusive, going forward around   **
+** the tour). Since the tour is a cycle, reversing the complementary path gives the  **
+** same tour, so whichever of the two is shorter is reversed.                        **
+**************************************************************************************/
+static void reversePath(Replica& r, int from, int to)
+{
+	int n = static_cast<int>(r.tour.size());
+	int length = (to - from + n) % n + 1;
+	if(2 * length > n)
+	{
+		int newFrom = (to + 1) % n;
+		to = (from + n - 1) % n;
+		from = newFrom;
+		length = n - length;
+	}
+	for(int k = 0; k < length / 2; k++)
+	{
+		int i = (from + k) % n;
+		int j = (to - k + n) % n;
+		std::swap(r.tour[i], r.tour[j]);
+		r.position[r.tour[i]] = i;
+		r.position[r.tour[j]] = j;
+	}
+}
+
+/**************************************************************************************
+**                                   twoOptMove                                      **
+** Picks a random city a and one of its candidate neighbors c, and proposes          **
+** replacing edges (a, next(a)) and (c, next(c)) by (a, c) and (next(a), next(c)).   **
+**************************************************************************************/
+template <class Distance>
+static void twoOptMove(Replica& r, const Distance& graph,
+                       const vector<vector<int>>& candidates)
+{
+	int n = static_cast<int>(r.tour.size());
+	int a = r.random() % n;
+	if(candidates[a].empty())
+	{
+		return;
+	}
+	int c = candidates[a][r.random() % candidates[a].size()];
+	int b = successor(r, a);
+	int d = successor(r, c);
+	if(c == b || d == a)
+	{
+		return;		//(The two edges share a city.)
+	}
+	int delta = graph(a, c) + graph(b, d) - graph(a, b) - graph(c, d);
+	if(accept(r, delta))
+	{
+		reversePath(r, r.position[b], r.position[c]);
+		r.distance += delta;
+	}
+}
+
+/**************************************************************************************
+**                                    orOptMove                                      **
+** Picks a random segment of 1-3 cities (starting at city s1) and proposes moving it **
+** between a candidate neighbor c of s1 and next(c), in whichever orientation is     **
+** shorter. The cities between the old and new location are shifted over by the     **
+** segment length, going around whichever side of the tour is shorter.              **
+**************************************************************************************/
+template <class Distance>
+static void orOptMove(Replica& r, const Distance& graph,
+                      const vector<vector<int>>& candidates)
+{
+	int n = static_cast<int>(r.tour.size());
+	int length = 1 + r.random() % 3;
+	int s1 = r.random() % n;
+	if(n < length + 3 || candidates[s1].empty())
+	{
+		return;
+	}
+	int start = r.position[s1];
+	int sL = r.tour[(start + length - 1) % n];
+	int p = predecessor(r, s1);
+	int q = successor(r, sL);
+	int c = candidates[s1][r.random() % candidates[s1].size()];
+	if((r.position[c] - start + n) % n < length || c == p)
+	{
+		return;		//(c is in the segment, or the segment is already after c.)
+	}
+	int e = successor(r, c);
+
+	int removed = graph(p, s1) + graph(sL, q) - graph(p, q);
+	int addedForward = graph(c, s1) + graph(sL, e) - graph(c, e);
+	int addedReversed = graph(c, sL) + graph(s1, e) - graph(c, e);
+	bool reversed = addedReversed < addedForward;
+	int delta = (reversed ? addedReversed : addedForward) - removed;
+	if(!accept(r, delta))
+	{
+		return;
+	}
+
+	int segment[3];
+	for(int m = 0; m < length; m++)
+	{
+		segment[m] = r.tour[(start + m) % n];
+	}
+	if(reversed)
+	{
+		std::reverse(segment, segment + length);
+	}
+	int ahead = (r.position[c] - r.position[sL] + n) % n;		//Cities q..c
+	int behind = n - length - ahead;							//Cities e..p
+	int first;
+	if(ahead <= behind)
+	{
+		//Shift q..c back over the segment; the segment goes just before e.
+		for(int k = 0; k < ahead; k++)
+		{
+			int city = r.tour[(start + length + k) % n];
+			r.tour[(start + k) % n] = city;
+			r.position[city] = (start + k) % n;
+		}
+		first = (start + ahead) % n;
+	}
+	else
+	{
+		//Shift e..p forward over the segment; the segment goes just after c.
+		for(int k = 1; k <= behind; k++)
+		{
+			int city = r.tour[(start - k + n) % n];
+			r.tour[(start - k + length + n) % n] = city;
+			r.position[city] = (start - k + length + n) % n;
+		}
+		first = (start - behind + n) % n;
+	}
+	for(int m = 0; m < length; m++)
+	{
+		r.tour[(first + m) % n] = segment[m];
+		r.position[segment[m]] = (first + m) % n;
+	}
+	r.distance += delta;
+}
+
+/**************************************************************************************
+**                            parallelTemperingImprove                               **
+** This function receives a tour tuple (tsp solution), the distance source and the   **
+** candidate lists, and improves the tour by parallel tempering. The replicas are    **
+** annealed in rounds on a thread pool. Between rounds, the best tour seen is        **
+** recorded and neighboring replicas i and i + 1 swap tours with probability         **
+** min(1, e^((1/T_i - 1/T_i+1) * (E_i - E_i+1))). The tour tuple is replaced only by  **
+** a tour that is shorter, and it keeps its first city.                              **
+**************************************************************************************/
+template <class Distance>
+void parallelTemperingImprove(tuple<int, vector<int>> &tspTour,
+                              const Distance& graph,
+                              const vector<vector<int>> &candidates,
+                              const AnnealingSettings& settings)
+{
+	int n = static_cast<int>(get<1>(tspTour).size());
+	if(n < 5 || settings.timeLimitSeconds <= 0 || get<0>(tspTour) <= settings.targetDistance)
+	{
+		return;
+	}
+	std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+	int replicaCount = std::max(1, settings.replicaCount);
+	const int movesPerRound = std::max(10000, 2 * n);
+
+	//Temperatures run geometrically from 1% to 30% of the average edge length.
+	double averageEdge = static_cast<double>(get<0>(tspTour)) / n;
+	double coldest = std::max(0.01 * averageEdge, 1e-3);
+	double hottest = std::max(0.3 * averageEdge, coldest);
+	vector<Replica> replicas(replicaCount);
+	ThreadPool pool(std::min(replicaCount, ThreadPool::defaultThreadCount()));
+	for(int i = 0; i < replicaCount; i++)
+	{
+		Replica& r = replicas[i];
+		//(Filled in by a worker thread, so that with first touch placement the
+		//arrays land on a NUMA node that anneals them.)
+		Replica* replica = &r;
+		pool.submit([replica, &tspTour, n]()
+		{
+			replica->tour.assign(get<1>(tspTour).begin(), get<1>(tspTour).end());
+			replica->position.resize(n);
+			for(int j = 0; j < n; j++)
+			{
+				replica->position[replica->tour[j]] = j;
+			}
+		});
+		r.distance = get<0>(tspTour);
+		r.temperature = replicaCount == 1 ? coldest :
+		                coldest * std::pow(hottest / coldest, static_cast<double>(i) / (replicaCount - 1));
+		r.random.seed(settings.seed + 7919u * i);
+	}
+
+	vector<int> bestTour = get<1>(tspTour);
+	int bestDistance = get<0>(tspTour);
+	mt19937 exchangeRandom(settings.seed);
+	std::uniform_real_distribution<double> uniform(0.0, 1.0);
+	pool.wait();
+
+	for(int round = 0; ; round++)
+	{
+		for(int i = 0; i < replicaCount; i++)
+		{
+			Replica* r = &replicas[i];
+			pool.submit([r, &graph, &candidates, movesPerRound]()
+			{
+				for(int move = 0; move < movesPerRound; move++)
+				{
+					if(r->random() & 1)
+					{
+						twoOptMove(*r, graph, candidates);
+					}
+					else
+					{
+						orOptMove(*r, graph, candidates);
+					}
+				}
+			});
+		}
+		pool.wait();
+
+		for(int i = 0; i < replicaCount; i++)
+		{
+			if(replicas[i].distance < bestDistance)
+			{
+				bestDistance = replicas[i].distance;
+				bestTour.assign(replicas[i].tour.begin(), replicas[i].tour.end());
+			}
+		}
+		std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - begin;
+		if(elapsed.count() >= settings.timeLimitSeconds || bestDistance <= settings.targetDistance)
+		{
+			break;
+		}
+
+		//Replica exchange, alternating between even and odd pairs each round.
+		for(int i = round % 2; i + 1 < replicaCount; i += 2)
+		{
+			Replica& cold = replicas[i];
+			Replica& hot = replicas[i + 1];
+			double exponent = (1 / cold.temperature - 1 / hot.temperature) *
+			                  (cold.distance - hot.distance);
+			if(exponent >= 0 || uniform(exchangeRandom) < std::exp(exponent))
+			{
+				cold.tour.swap(hot.tour);
+				cold.position.swap(hot.position);
+				std::swap(cold.distance, hot.distance);
+			}
+		}
+	}
+
+	if(bestDistance < get<0>(tspTour))
+	{
+		std::rotate(bestTour.begin(), std::find(bestTour.begin(), bestTour.end(), get<1>(tspTour)[0]),
+		            bestTour.end());
+		get<1>(tspTour) = bestTour;
+		get<0>(tspTour) = bestDistance;
+	}
+}
+
+/**************************************************************************************
+**                             independentAnnealingRuns                              **
+** Runs runCount independent parallel tempering runs at once (seeds settings.seed,   **
+** settings.seed + 1, ...; the replicas are split between the runs), then merges     **
+** their tours by partition crossover (see tourMerging.cpp). Independent runs end    **
+** in different local optima, and merging them keeps the best parts of each.         **
+**************************************************************************************/
+template <class Distance>
+void independentAnnealingRuns(tuple<int, vector<int>> &tspTour,
+                              const Distance& graph,
+                              const vector<vector<int>> &candidates,
+                              const AnnealingSettings& settings, int runCount)
+{
+	vector<tuple<int, vector<int>>> runs(runCount, tspTour);
+	ThreadPool pool(runCount);
+	for(int r = 0; r < runCount; r++)
+	{
+		AnnealingSettings runSettings = settings;
+		runSettings.seed = settings.seed + r;
+		runSettings.replicaCount = std::max(1, settings.replicaCount / runCount);
+		tuple<int, vector<int>>* run = &runs[r];
+		pool.submit([run, &graph, &candidates, runSettings]()
+		{
+			parallelTemperingImprove(*run, graph, candidates, runSettings);
+		});
+	}
+	pool.wait();
+	tspTour = mergeTours(runs, graph);
+}
+
+//(See FOR_EACH_DISTANCE_SOURCE in tspMetrics.hpp.)
+#define INSTANTIATE_ANNEALING(Distance) \
+	template void parallelTemperingImprove<Distance>(tuple<int, vector<int>>&, const Distance&, \
+	                                                 const vector<vector<int>>&, const AnnealingSettings&); \
+	template void independentAnnealingRuns<Distance>(tuple<int, vector<int>>&, const Distance&, \
+	                                                 const vector<vector<int>>&, const AnnealingSettings&, int);
+FOR_EACH_DISTANCE_SOURCE(INSTANTIATE_ANNEALING)
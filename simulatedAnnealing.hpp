@@ -0,0 +1,45 @@
+/******************************************************************************
+** Program name: simulatedAnnealing.hpp
+** Class name: CS325-400
+** Author: Ben Fridkis
+** Date: 10/18/2026
+** Description: Declarations for the multi-replica simulated annealing
+**				(parallel tempering) tour improvement mode.
+*******************************************************************************/
+
+#ifndef SIMULATED_ANNEALING_HPP
+#define SIMULATED_ANNEALING_HPP
+
+#include <vector>
+#include <tuple>
+
+//Settings for parallelTemperingImprove. The run ends when timeLimitSeconds
+//have passed, or as soon as the best tour is at or below targetDistance.
+struct AnnealingSettings{
+	double timeLimitSeconds;
+	int replicaCount;
+	unsigned seed;
+	int targetDistance;
+	AnnealingSettings()
+	{
+		timeLimitSeconds = 0;
+		replicaCount = 1;
+		seed = 1;
+		targetDistance = 0;
+	}
+};
+
+//(Defined in simulatedAnnealing.cpp for each distance source in tspMetrics.hpp.)
+template <class Distance>
+void parallelTemperingImprove(std::tuple<int, std::vector<int>> &tspTour,
+                              const Distance& graph,
+                              const std::vector<std::vector<int>> &candidates,
+                              const AnnealingSettings& settings);
+
+template <class Distance>
+void independentAnnealingRuns(std::tuple<int, std::vector<int>> &tspTour,
+                              const Distance& graph,
+                              const std::vector<std::vector<int>> &candidates,
+                              const AnnealingSettings& settings, int runCount);
+
+#endif
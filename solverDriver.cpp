@@ -0,0 +1,468 @@
+/******************************************************************************
+** Program name: solverDriver.cpp
+** Class name: CS325-400
+** Author: Ben Fridkis
+** Date: 10/18/2026
+** Description: The driver greedyTSP_w2Opt and nearestNeighborTSP_w2Opt
+**				share: the input is read and planned for, the tour is
+**				built and improved as the ExecutionPlan decides, and the
+**				tour is written out. Only the tour built from the full
+**				heaps of edges differs between the programs; each defines
+**				its own loadHeapTour (see solverDriver.hpp).
+*******************************************************************************/
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <tuple>
+#include <chrono>
+#include "solverDriver.hpp"
+#include "solverOptions.hpp"
+#include "heldKarpBound.hpp"
+#include "tspCities.hpp"
+#include "tspMetrics.hpp"
+#include "tsplibReader.hpp"
+#include "spaceFillingCurve.hpp"
+#include "cityRenumbering.hpp"
+#include "simulatedAnnealing.hpp"
+#include "tourMerging.hpp"
+#include "threadPool.hpp"
+#include "executionPlanner.hpp"
+#include "spatialGrid.hpp"
+#include "candidateTours.hpp"
+#include "cityStream.hpp"
+#include "exactSolver.hpp"
+#include "steepestTwoOpt.hpp"
+using std::vector;
+using std::string;
+using std::ofstream;
+using std::cout;
+using std::endl;
+using std::tuple;
+using std::get;
+
+/**************************************************************************************
+**                          loadGraphOfMapAsVectors                                  **
+** This function creates the map representation in memory. It returns a vector of    **
+** vectors which each have CityDistance structs (or edges). The first element        **
+** (vector) of the returned vector holds the edges (as CityDistance structs) for     **
+** city 0, the second element city 1, and so forth. The vectors of CityDistances for **
+** each city maintain sequential order of distances to all other cities.             **
+** (i.e. graph[1][0] represents the distance from city 1 to city 0, and so forth).   **
+** This graph representation is used specifically for the 2-Opt tour improvement.    **
+**************************************************************************************/
+template <class Distance>
+DistanceMatrix loadGraphOfMapAsVectors(int cityCount, const Distance& distance)
+{
+	DistanceMatrix graph;
+	graph.reserve(cityCount);
+
+	//For every vertex, the distances to all other vertices are calculated and stored
+	//since the TSP problem graph is complete (i.e. any city can be accessed from any other).
+	//(Each row is allocated once at its final size, so that with the bulk memory
+	//arena the rows follow one another with no gaps, and left unwritten: the rows
+	//are filled by the pool's threads, a block each, so that with first touch
+	//placement each block lands on the NUMA node of the thread that wrote it.)
+	for(int i = 0; i < cityCount; i++)
+	{
+		graph.push_back(BulkVector<int>(cityCount));
+	}
+	ThreadPool pool(ThreadPool::defaultThreadCount());
+	int blockCount = pool.size();
+	for(int block = 0; block < blockCount; block++)
+	{
+		int first = static_cast<int>(static_cast<long long>(cityCount) * block / blockCount);
+		int last = static_cast<int>(static_cast<long long>(cityCount) * (block + 1) / blockCount);
+		pool.submit([&graph, &distance, cityCount, first, last]()
+		{
+			for(int i = first; i < last; i++)
+			{
+				for(int j = 0; j < cityCount; j++)
+				{
+					graph[i][j] = distance(i, j);
+				}
+			}
+		});
+	}
+	pool.wait();
+
+	return graph;
+}
+
+/****************************************************************************
+**                             twoOptImprove                               **
+** This function receives a tour tuple (tsp solution) and a vector graph   **
+** (see 'loadMapAsGraphOfVectors' above), and attempts to restructure the  **
+** the tour by 'swapping' eligible pairs of edges, if said swap reduces    **
+** the total tour distance. This is in attempt to eliminate path cross-    **
+** over that contributes to sub-optimality. When a swap occurs, the path   **
+** in between the vertices swapped is reversed,to maintain the tour        **
+** integrity. See https://en.wikipedia.org/wiki/2-opt and                  **
+** http://pedrohfsd.com/2017/08/09/2opt-part1.html for more details.       **
+** Improvement stops early once the tour distance is at or below           **
+** targetDistance (pass 0 to run until no further improvement is found).   **
+****************************************************************************/
+template <class Distance>
+void twoOptImprove(tuple<int, vector<int>> &tspTour,
+                   const Distance &graph, int targetDistance, bool restartAfterSwap)
+{
+	//This variable (breakOutToOptimize) is set to allow the loop to repeat
+	//until the optimal improvement is obtained when restartAfterSwap is true
+	//(the planner sets it when the estimated running time allows, see
+	//executionPlanner.cpp). In this case, execution exits both the inner and
+	//outer loops when each swap is made, and the process repeats until no
+	//further improvement is possible. Otherwise, each pass runs all the way
+	//through to ensure a reasonable running time (at the expense of optimality).
+	//(Note the control statement `breakOutToOptimize == false` in both the inner
+	//and outer for loops.)
+	bool breakOutToOptimize;
+	bool improved;
+	bool targetReached = get<0>(tspTour) <= targetDistance;
+
+    while(!targetReached)
+    {
+		improved = false;
+		breakOutToOptimize = false;
+		//(Can't swap 1st city so i starts at 1...)
+        for(int i = 1; i < static_cast<int>(get<1>(tspTour).size()) - 2 &&
+				breakOutToOptimize == false; i++)
+        {
+            for(int j = i, k = i + 1; k < static_cast<int>(get<1>(tspTour).size()) &&
+					breakOutToOptimize == false; k++)
+            {
+				//Adjacent vertices are not eligible for consideration
+				//because there is only one edge between them.
+				if(k - j == 1)
+				{
+					continue;
+				}
+
+				//If distance(i to i + j -1) + distance(i + 1, j) <
+				//distance(i to i + 1) + distance(j - 1 to j), the swap
+				//will improve the tour. In other words, if taking out the two
+				//edges before the swap and inserting two new edges (because of swap)
+				//results in shorter tour, the cities are swapped in tour order.
+				if(graph(get<1>(tspTour)[j], get<1>(tspTour)[k - 1]) +
+				   graph(get<1>(tspTour)[j + 1], get<1>(tspTour)[k]) <
+				   graph(get<1>(tspTour)[j], get<1>(tspTour)[j + 1]) +
+				   graph(get<1>(tspTour)[k - 1], get<1>(tspTour)[k]))
+				{
+
+					//Update tour distance based on swapped edges.
+					get<0>(tspTour) -=  (graph(get<1>(tspTour)[j], get<1>(tspTour)[j + 1]) +
+										 graph(get<1>(tspTour)[k - 1], get<1>(tspTour)[k])) -
+										(graph(get<1>(tspTour)[j], get<1>(tspTour)[k - 1]) +
+										 graph(get<1>(tspTour)[j + 1], get<1>(tspTour)[k]));
+
+					improved = true;
+					//Only need to reverse cities in between swapped routes (edges).
+					for(int l = j + 1, m = k - 1; l < m; l++, m--)
+					{
+						int temp = get<1>(tspTour)[l];
+						get<1>(tspTour)[l] = get<1>(tspTour)[m];
+						get<1>(tspTour)[m] = temp;
+					}
+					//Allow optimization of improvement if the planner found the time for it.
+					//(Otherwise, additional time cost is unreasonable, run 2Opt-swap once over only.)
+					//If enabled, execution exits both inner and outer loop after improvement to
+					//start over.
+					if(restartAfterSwap)
+					{
+						breakOutToOptimize = true;
+					}
+					//Stop as soon as the tour is "good enough" (see --target-gap).
+					if(get<0>(tspTour) <= targetDistance)
+					{
+						targetReached = true;
+						breakOutToOptimize = true;
+					}
+				}
+            }
+        }
+		if(!improved)
+		{
+			break;
+		}
+    }
+}
+
+/**************************************************************************************
+**                                  TourSolver                                       **
+** Builds the initial tour and improves it, as decided by the ExecutionPlan, with    **
+** the tour constructors of the program being run (program). Its operator() is a     **
+** template on the distance metric, so withDistanceMetric (see tspMetrics.hpp)       **
+** instantiates everything once per metric; improve is instantiated once more for    **
+** each way the plan may store the distances.                                        **
+**************************************************************************************/
+struct TourSolver{
+	const TspInstance& instance;
+	const SolverOptions& options;
+	const ExecutionPlan& plan;
+	ProgramConstructor program;
+	const vector<int>& originalIds;
+	StreamedDistances& streamed;
+	tuple<int, vector<int>> tspTour;
+	vector<vector<int>> candidates;
+	int heldKarpBound;
+	ExactResult exactResult;
+	TourSolver(const TspInstance& i, const SolverOptions& o, const ExecutionPlan& p,
+	           ProgramConstructor c, const vector<int>& ids, StreamedDistances& s)
+		: instance(i), options(o), plan(p), program(c), originalIds(ids), streamed(s),
+		  heldKarpBound(0) {}
+
+	template <class Metric>
+	void operator()(const Metric& metric)
+	{
+		int cityCount = static_cast<int>(instance.cities.size());
+		//(An EXPLICIT instance's coordinates, if any, are for display only.)
+		bool useCoordinates = instance.hasCoordinates && instance.edgeWeightType != EXPLICIT;
+		if(plan.needsCandidates)
+		{
+			//(The grid finds neighbors by straight-line distance, which GEO distances
+			//do not follow closely enough for the Held-Karp ascent.)
+			candidates = useCoordinates && instance.edgeWeightType != GEO ?
+			             nearestNeighborLists(instance.cities, plan.candidatesPerCity) :
+			             buildCandidateLists(cityCount, metric, plan.candidatesPerCity);
+		}
+
+		if(options.tourConstructor == HILBERT_CONSTRUCTOR)
+		{
+			//Space-filling curve tour: O(n log n), and no distance precomputation.
+			tspTour = loadHilbertTour(instance.cities, metric);
+		}
+		else if(options.tourConstructor == CHEAPEST_INSERTION_CONSTRUCTOR)
+		{
+			//Insertion tours, from the candidate lists and a spatial index
+			//(see candidateTours.cpp).
+			tspTour = loadCheapestInsertionTour(instance.cities, useCoordinates, metric, candidates);
+		}
+		else if(options.tourConstructor == FARTHEST_INSERTION_CONSTRUCTOR)
+		{
+			tspTour = loadFarthestInsertionTour(instance.cities, useCoordinates, metric, candidates);
+		}
+		else if(options.tourConstructor == PARALLEL_GREEDY_CONSTRUCTOR)
+		{
+			//Greedy matching in rounds on every core (see candidateTours.cpp).
+			tspTour = loadParallelGreedyTour(instance.cities, useCoordinates, metric, candidates);
+		}
+		else if(plan.candidateConstruction)
+		{
+			//The program's method, O(n k) memory instead of O(n^2) (see candidateTours.cpp).
+			tspTour = program == GREEDY_EDGE_HEAP ?
+			          loadGreedyCandidateTour(instance.cities, useCoordinates, metric, candidates) :
+			          loadNearestNeighborCandidateTour(instance.cities, useCoordinates, metric, candidates);
+		}
+		else if(streamed.complete)
+		{
+			//(Defined by the program, see solverDriver.hpp. The heaps read the
+			//distances computed while the input was read, which are then handed
+			//back for the distance storage below.)
+			TriangularMatrixDistance streamedMatrix(streamed.weights);
+			tspTour = loadHeapTour(cityCount, streamedMatrix);
+			streamedMatrix.release(streamed.weights);
+		}
+		else
+		{
+			tspTour = loadHeapTour(cityCount, metric);
+		}
+
+		//2-Opt and everything after it read the distances from where the plan
+		//stores them.
+		if(plan.distanceStorage == FULL_MATRIX && streamed.complete)
+		{
+			//(Copied from the distances computed while the input was read, see
+			//cityStream.cpp, which are freed before 2-Opt.)
+			DistanceMatrix graph2 = loadGraphOfMapAsVectors(cityCount,
+			                                                TriangularMatrixDistance(streamed.weights));
+			improve(MatrixDistance(graph2));
+		}
+		else if(plan.distanceStorage == FULL_MATRIX)
+		{
+			DistanceMatrix graph2 = loadGraphOfMapAsVectors(cityCount, metric);
+			improve(MatrixDistance(graph2));
+		}
+		else if(plan.distanceStorage == TRIANGULAR_MATRIX && streamed.complete)
+		{
+			//(Computed while the input was read, see cityStream.cpp.)
+			improve(TriangularMatrixDistance(streamed.weights));
+		}
+		else if(plan.distanceStorage == TRIANGULAR_MATRIX)
+		{
+			improve(TriangularMatrixDistance(cityCount, metric));
+		}
+		else
+		{
+			improve(metric);
+		}
+	}
+
+	template <class Distance>
+	void improve(const Distance& distance)
+	{
+		int cityCount = static_cast<int>(instance.cities.size());
+
+		//The Held-Karp bound (if requested) is computed before 2-Opt so that
+		//improvement can stop as soon as the tour is within the target gap.
+		int targetDistance = 0;
+		if(options.computeHeldKarpBound)
+		{
+			heldKarpBound = computeHeldKarpBound(cityCount, distance, candidates, get<0>(tspTour));
+			if(options.targetGapPercent >= 0)
+			{
+				targetDistance = static_cast<int>(heldKarpBound * (1 + options.targetGapPercent / 100));
+			}
+		}
+		if(options.twoOptMode == BEST_IMPROVEMENT)
+		{
+			//Best move first, from a queue of move gains (see steepestTwoOpt.cpp).
+			steepestTwoOptImprove(tspTour, distance, candidates, targetDistance);
+		}
+		else
+		{
+			twoOptImprove(tspTour, distance, targetDistance, plan.twoOptRestart);
+		}
+
+		//Small instances can be solved optimally, starting from the 2-Opt tour (see
+		//exactSolver.cpp). An optimal tour needs no further improvement.
+		if(options.exactSolution)
+		{
+			exactResult = solveExactly(tspTour, cityCount, distance, ThreadPool::defaultThreadCount(),
+			                           options.timeBudgetSeconds);
+			if(exactResult.provenOptimal)
+			{
+				return;
+			}
+		}
+
+		//Simulated annealing picks up where 2-Opt gets stuck (see simulatedAnnealing.cpp).
+		if(options.annealSeconds > 0)
+		{
+			AnnealingSettings settings;
+			settings.timeLimitSeconds = options.annealSeconds;
+			settings.replicaCount = options.replicaCount > 0 ? options.replicaCount :
+			                        ThreadPool::defaultThreadCount();
+			settings.seed = options.seed;
+			settings.targetDistance = targetDistance;
+			if(options.independentRuns > 1)
+			{
+				independentAnnealingRuns(tspTour, distance, candidates, settings, options.independentRuns);
+			}
+			else
+			{
+				parallelTemperingImprove(tspTour, distance, candidates, settings);
+			}
+		}
+
+		//Tours from earlier runs are folded in by partition crossover (see tourMerging.cpp).
+		if(!options.mergeTourFiles.empty())
+		{
+			mergeTourFiles(tspTour, options.mergeTourFiles, distance, originalIds);
+		}
+	}
+};
+
+/**************************************************************************************
+**                                runTourSolver                                      **
+** Runs either program on its command line (see solverOptions.cpp): reads the input, **
+** plans the run for the program's constructor (program), solves, prints the         **
+** results and writes the tour to <input file>.tour. Returns the exit status.        **
+**************************************************************************************/
+int runTourSolver(int argc, char *argv[], ProgramConstructor program)
+{
+	SolverOptions options = parseSolverOptions(argc, argv);
+	configureBulkMemory(options.bulkPages, options.numaPlacement);
+	//(Wall clock time, since the annealing mode runs on several threads.)
+	std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+
+	//Distances the planner would store anyway are computed while the input is
+	//still being read (see cityStream.cpp).
+	StreamedDistances streamed;
+	StreamSetup setup = [&](EdgeWeightType edgeWeightType, int expectedCities) -> vector<ChunkConsumer>
+	{
+		vector<ChunkConsumer> consumers;
+		double byteLimit = streamedDistanceBytes(edgeWeightType, program, options);
+		if(byteLimit > 0)
+		{
+			consumers.push_back(distanceTileConsumer(edgeWeightType, expectedCities, byteLimit, streamed));
+		}
+		return consumers;
+	};
+	TspInstance instance = loadTspInstance(options.dataInputFileName, setup);
+	if(!instance.hasCoordinates &&
+	   (options.tourConstructor == HILBERT_CONSTRUCTOR || options.renumbering != NO_RENUMBERING))
+	{
+		std::cerr << "\nThe Hilbert constructor and --renumber need city coordinates," << endl
+		          << "which this (EXPLICIT) instance does not have.\n" << endl;
+		exit(1);
+	}
+
+	//Optionally relabel the cities so that cities near each other on the map are
+	//also near each other in memory. Everything below uses the new labels, which
+	//are mapped back to the input file's ids when the tour is written.
+	vector<int> originalIds;
+	if(options.renumbering != NO_RENUMBERING)
+	{
+		vector<int> order = options.renumbering == HILBERT_RENUMBERING ?
+		                    hilbertOrder(instance.cities) : kdTreeOrder(instance.cities);
+		originalIds = renumberCities(instance.cities, order);
+		renumberEdgeWeights(instance.edgeWeights, order);
+	}
+
+	//Decide how to store distances and build the tour within the memory limit.
+	if(!streamed.matches(instance.cities))
+	{
+		streamed = StreamedDistances();
+	}
+	ExecutionPlan plan = planExecution(static_cast<int>(instance.cities.size()), instance.edgeWeightType,
+	                                   program, options, streamed.complete);
+	printExecutionPlan(plan, program, options);
+	if(plan.distanceStorage == ON_DEMAND)
+	{
+		streamed = StreamedDistances();
+	}
+
+	TourSolver solver(instance, options, plan, program, originalIds, streamed);
+	withDistanceMetric(instance.edgeWeightType, instance.cities, instance.edgeWeights, solver);
+	tuple<int, vector<int>>& tspTour = solver.tspTour;
+	int heldKarpBound = solver.heldKarpBound;
+
+	std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - begin;
+	double elapsed_secs = elapsed.count();
+	cout << "\nRunning Time: " << elapsed_secs << endl;
+	cout << "Tour Distance: " << get<0>(tspTour) << endl;
+	if(options.computeHeldKarpBound)
+	{
+		cout << "Held-Karp Bound: " << heldKarpBound << endl;
+		cout << "Optimality Gap: " << optimalityGapPercent(get<0>(tspTour), heldKarpBound)
+		     << "%" << endl;
+	}
+	if(options.exactSolution)
+	{
+		cout << "Exact Solver: " << describeExactResult(solver.exactResult) << endl;
+	}
+	if(bulkArenaEnabled())
+	{
+		cout << "Bulk Memory: " << describeBulkMemory() << endl;
+	}
+	cout << endl;
+
+	if(!originalIds.empty())
+	{
+		restoreOriginalIds(get<1>(tspTour), originalIds);
+	}
+
+	ofstream dataOut;
+	string inputFileName = options.dataInputFileName;
+	if(inputFileName == "-")
+	{
+		inputFileName = "stdin";		//(Read from stdin: write stdin.tour.)
+	}
+	dataOut.open(inputFileName + ".tour");
+	dataOut << get<0>(tspTour) << "\n";
+	for(int i = 0; i < static_cast<int>(get<1>(tspTour).size()); i++)
+    {
+        dataOut << get<1>(tspTour)[i] << "\n";
+    }
+
+	return 0;
+}
@@ -0,0 +1,27 @@
+/******************************************************************************
+** Program name: solverDriver.hpp
+** Class name: CS325-400
+** Author: Ben Fridkis
+** Date: 10/18/2026
+** Description: Declarations for the driver shared by greedyTSP_w2Opt and
+**				nearestNeighborTSP_w2Opt, and for the one piece each
+**				program supplies: its tour from the full heaps of edges.
+*******************************************************************************/
+
+#ifndef SOLVER_DRIVER_HPP
+#define SOLVER_DRIVER_HPP
+
+#include <vector>
+#include <tuple>
+#include "executionPlanner.hpp"
+
+//Builds the initial tour from heaps holding every edge (O(n^2) memory, used when
+//the plan has room for them). Defined by each program (greedyTSP_w2Opt.cpp,
+//nearestNeighborTSP_w2Opt.cpp) for each distance source in tspMetrics.hpp.
+template <class Distance>
+std::tuple<int, std::vector<int>> loadHeapTour(int cityCount, const Distance& distance);
+
+//Runs the program whose heap tour is program (see solverDriver.cpp).
+int runTourSolver(int argc, char *argv[], ProgramConstructor program);
+
+#endif
@@ -0,0 +1,308 @@
+/******************************************************************************
+** Program name: solverOptions.cpp
+** Class name: CS325-400
+** Author: Ben Fridkis
+** Date: 10/18/2026
+** Description: Parses the command line options shared by the TSP solver
+**				programs. See solverOptions.hpp for the available flags.
+*******************************************************************************/
+
+#include "solverOptions.hpp"
+#include <iostream>
+#include <string>
+#include <cstdlib>
+using std::string;
+using std::cout;
+using std::endl;
+
+//Prints the accepted flags and exits. Used for any malformed command line.
+static void printUsageAndExit(char* programName)
+{
+	cout << "\nUsage: " << programName << " file.txt [options]" << endl
+	     << "(file.txt has one 'city x y' line per city; TSPLIB files ending" << endl
+	     << "in .tsp are also accepted, with EUC_2D, CEIL_2D, ATT, GEO or" << endl
+	     << "EXPLICIT edge weights. Use '-' as file.txt to read either format" << endl
+	     << "from stdin, e.g. piped from another program; a FIFO also works.)" << endl
+	     << "Options:" << endl
+	     << "  --held-karp             Compute the Held-Karp (1-tree) lower bound" << endl
+	     << "                          and report the optimality gap." << endl
+	     << "  --target-gap <percent>  Stop tour improvement once the tour is within" << endl
+	     << "                          <percent> of the Held-Karp bound." << endl
+	     << "  --constructor <name>    Initial tour construction method:" << endl
+	     << "                          default     the program's own method" << endl
+	     << "                          heap        the same, from all n^2 edges" << endl
+	     << "                          candidates  the same, from candidate lists" << endl
+	     << "                          hilbert     Hilbert space-filling curve order" << endl
+	     << "                          cheapest    cheapest insertion" << endl
+	     << "                          farthest    farthest insertion" << endl
+	     << "                          parallel    greedy matching from candidate" << endl
+	     << "                                      lists, in rounds on every core" << endl
+	     << "  --renumber <order>      Relabel cities in spatial order before solving" << endl
+	     << "                          (none, hilbert or kd) for better cache use." << endl
+	     << "  --two-opt <mode>        2-Opt variant: first (the default) takes the" << endl
+	     << "                          first improving swap found; best applies the" << endl
+	     << "                          best move on the candidate lists each time." << endl
+	     << "  --anneal <seconds>      After 2-Opt, improve the tour by simulated" << endl
+	     << "                          annealing (parallel tempering) for <seconds>." << endl
+	     << "  --replicas <count>      Annealing replicas (default: one per core)." << endl
+	     << "  --seed <number>         Random seed for annealing (default: 1)." << endl
+	     << "  --independent-runs <k>  With --anneal, run k independent annealing runs" << endl
+	     << "                          and merge their tours by partition crossover." << endl
+	     << "  --merge <file.tour>     Merge the final tour with a tour from an earlier" << endl
+	     << "                          run (may be given more than once)." << endl
+	     << "  --memory-limit <size>   Memory the solver may plan to use, in bytes or" << endl
+	     << "                          with a K, M or G suffix (default: the cgroup" << endl
+	     << "                          limit or physical memory, whichever is less)." << endl
+	     << "  --time-budget <seconds> Running time the planner aims for: the original" << endl
+	     << "                          pipeline (all n^2 edges, full matrix) is kept" << endl
+	     << "                          if it fits, and otherwise it decides how" << endl
+	     << "                          thoroughly to run 2-Opt (default: 60)." << endl
+	     << "  --exact                 Solve instances of up to 200 cities optimally" << endl
+	     << "                          (dynamic program up to 16 cities, then branch" << endl
+	     << "                          and bound, stopped at the time budget)." << endl
+	     << "  --bulk-memory <pages>   Where the bulk arrays (distance matrices, edge" << endl
+	     << "                          heaps, per-city and per-edge arrays of the tour" << endl
+	     << "                          constructors, spatial grid and steepest descent," << endl
+	     << "                          annealing tours) are allocated: default (the" << endl
+	     << "                          standard allocator), or an arena on 4 KB pages" << endl
+	     << "                          (arena), transparent huge pages (thp) or the" << endl
+	     << "                          reserved huge page pool (hugetlb). Arrays under" << endl
+	     << "                          4 KB, such as each city's candidate list, always" << endl
+	     << "                          use the standard allocator." << endl
+	     << "  --numa <placement>      With --bulk-memory, first-touch (the default)" << endl
+	     << "                          or interleave the arena over the NUMA nodes." << endl << endl;
+	exit(1);
+}
+
+/**************************************************************************************
+**                              parseSolverOptions                                   **
+** This function reads the input file name (first argument) and any optional flags   **
+** that follow it, returning them in a SolverOptions struct. Unknown flags or flags  **
+** missing their value print the usage message and end the program.                 **
+**************************************************************************************/
+SolverOptions parseSolverOptions(int argc, char *argv[])
+{
+	SolverOptions options;
+	if(argc < 2)
+	{
+		return options;		//(Missing file name is reported by the loaders.)
+	}
+	options.dataInputFileName = argv[1];
+
+	for(int i = 2; i < argc; i++)
+	{
+		string flag = argv[i];
+		if(flag == "--held-karp")
+		{
+			options.computeHeldKarpBound = true;
+		}
+		else if(flag == "--exact")
+		{
+			options.exactSolution = true;
+		}
+		else if(flag == "--target-gap" && i + 1 < argc)
+		{
+			char* end;
+			options.targetGapPercent = strtod(argv[++i], &end);
+			if(*end != '\0' || options.targetGapPercent < 0)
+			{
+				printUsageAndExit(argv[0]);
+			}
+			//A target gap is meaningless without the bound.
+			options.computeHeldKarpBound = true;
+		}
+		else if(flag == "--constructor" && i + 1 < argc)
+		{
+			string name = argv[++i];
+			if(name == "default")
+			{
+				options.tourConstructor = PROGRAM_CONSTRUCTOR;
+			}
+			else if(name == "heap")
+			{
+				options.tourConstructor = EDGE_HEAP_CONSTRUCTOR;
+			}
+			else if(name == "candidates")
+			{
+				options.tourConstructor = CANDIDATE_CONSTRUCTOR;
+			}
+			else if(name == "hilbert")
+			{
+				options.tourConstructor = HILBERT_CONSTRUCTOR;
+			}
+			else if(name == "cheapest")
+			{
+				options.tourConstructor = CHEAPEST_INSERTION_CONSTRUCTOR;
+			}
+			else if(name == "farthest")
+			{
+				options.tourConstructor = FARTHEST_INSERTION_CONSTRUCTOR;
+			}
+			else if(name == "parallel")
+			{
+				options.tourConstructor = PARALLEL_GREEDY_CONSTRUCTOR;
+			}
+			else
+			{
+				printUsageAndExit(argv[0]);
+			}
+		}
+		else if(flag == "--two-opt" && i + 1 < argc)
+		{
+			string mode = argv[++i];
+			if(mode == "first")
+			{
+				options.twoOptMode = FIRST_IMPROVEMENT;
+			}
+			else if(mode == "best")
+			{
+				options.twoOptMode = BEST_IMPROVEMENT;
+			}
+			else
+			{
+				printUsageAndExit(argv[0]);
+			}
+		}
+		else if(flag == "--bulk-memory" && i + 1 < argc)
+		{
+			string pages = argv[++i];
+			if(pages == "default")
+			{
+				options.bulkPages = STANDARD_ALLOCATOR;
+			}
+			else if(pages == "arena")
+			{
+				options.bulkPages = ARENA_SMALL_PAGES;
+			}
+			else if(pages == "thp")
+			{
+				options.bulkPages = TRANSPARENT_HUGE_PAGES;
+			}
+			else if(pages == "hugetlb")
+			{
+				options.bulkPages = EXPLICIT_HUGE_PAGES;
+			}
+			else
+			{
+				printUsageAndExit(argv[0]);
+			}
+		}
+		else if(flag == "--numa" && i + 1 < argc)
+		{
+			string placement = argv[++i];
+			if(placement == "first-touch")
+			{
+				options.numaPlacement = FIRST_TOUCH;
+			}
+			else if(placement == "interleave")
+			{
+				options.numaPlacement = INTERLEAVED;
+			}
+			else
+			{
+				printUsageAndExit(argv[0]);
+			}
+		}
+		else if(flag == "--renumber" && i + 1 < argc)
+		{
+			string order = argv[++i];
+			if(order == "none")
+			{
+				options.renumbering = NO_RENUMBERING;
+			}
+			else if(order == "hilbert")
+			{
+				options.renumbering = HILBERT_RENUMBERING;
+			}
+			else if(order == "kd")
+			{
+				options.renumbering = KD_TREE_RENUMBERING;
+			}
+			else
+			{
+				printUsageAndExit(argv[0]);
+			}
+		}
+		else if(flag == "--anneal" && i + 1 < argc)
+		{
+			char* end;
+			options.annealSeconds = strtod(argv[++i], &end);
+			if(*end != '\0' || options.annealSeconds <= 0)
+			{
+				printUsageAndExit(argv[0]);
+			}
+		}
+		else if(flag == "--replicas" && i + 1 < argc)
+		{
+			char* end;
+			options.replicaCount = static_cast<int>(strtol(argv[++i], &end, 10));
+			if(*end != '\0' || options.replicaCount < 1)
+			{
+				printUsageAndExit(argv[0]);
+			}
+		}
+		else if(flag == "--seed" && i + 1 < argc)
+		{
+			char* end;
+			options.seed = static_cast<unsigned>(strtoul(argv[++i], &end, 10));
+			if(*end != '\0')
+			{
+				printUsageAndExit(argv[0]);
+			}
+		}
+		else if(flag == "--independent-runs" && i + 1 < argc)
+		{
+			char* end;
+			options.independentRuns = static_cast<int>(strtol(argv[++i], &end, 10));
+			if(*end != '\0' || options.independentRuns < 1)
+			{
+				printUsageAndExit(argv[0]);
+			}
+		}
+		else if(flag == "--merge" && i + 1 < argc)
+		{
+			options.mergeTourFiles.push_back(argv[++i]);
+		}
+		else if(flag == "--memory-limit" && i + 1 < argc)
+		{
+			char* end;
+			options.memoryLimitBytes = strtod(argv[++i], &end);
+			string suffix = end;
+			if(suffix == "K" || suffix == "k")
+			{
+				options.memoryLimitBytes *= 1024.0;
+			}
+			else if(suffix == "M" || suffix == "m")
+			{
+				options.memoryLimitBytes *= 1024.0 * 1024.0;
+			}
+			else if(suffix == "G" || suffix == "g")
+			{
+				options.memoryLimitBytes *= 1024.0 * 1024.0 * 1024.0;
+			}
+			else if(suffix != "")
+			{
+				printUsageAndExit(argv[0]);
+			}
+			if(options.memoryLimitBytes <= 0)
+			{
+				printUsageAndExit(argv[0]);
+			}
+		}
+		else if(flag == "--time-budget" && i + 1 < argc)
+		{
+			char* end;
+			options.timeBudgetSeconds = strtod(argv[++i], &end);
+			if(*end != '\0' || options.timeBudgetSeconds <= 0)
+			{
+				printUsageAndExit(argv[0]);
+			}
+		}
+		else
+		{
+			printUsageAndExit(argv[0]);
+		}
+	}
+
+	return options;
+}
@@ -0,0 +1,89 @@
+/******************************************************************************
+** Program name: solverOptions.hpp
+** Class name: CS325-400
+** Author: Ben Fridkis
+** Date: 10/18/2026
+** Description: Declarations for the command line options shared by the
+**				TSP solver programs (greedyTSP_w2Opt.cpp and
+**				nearestNeighborTSP_w2Opt.cpp).
+*******************************************************************************/
+
+#ifndef SOLVER_OPTIONS_HPP
+#define SOLVER_OPTIONS_HPP
+
+#include <vector>
+#include "bulkMemory.hpp"
+
+//Tour construction methods selectable with --constructor. The default is the
+//program's own method (greedy edge matching or nearest neighbor), built from
+//the full edge heaps or from candidate lists as the planner decides (see
+//executionPlanner.cpp); "heap" and "candidates" force one or the other. The
+//others are the same in both programs.
+enum TourConstructor{
+	PROGRAM_CONSTRUCTOR,
+	EDGE_HEAP_CONSTRUCTOR,
+	CANDIDATE_CONSTRUCTOR,
+	HILBERT_CONSTRUCTOR,
+	CHEAPEST_INSERTION_CONSTRUCTOR,
+	FARTHEST_INSERTION_CONSTRUCTOR,
+	PARALLEL_GREEDY_CONSTRUCTOR
+};
+
+//2-Opt variants selectable with --two-opt: the programs' own first improvement
+//scan (twoOptImprove), or steepest descent on the candidate lists
+//(steepestTwoOpt.cpp).
+enum TwoOptMode{
+	FIRST_IMPROVEMENT,
+	BEST_IMPROVEMENT
+};
+
+//City relabeling orders selectable with --renumber (see cityRenumbering.cpp).
+enum CityRenumbering{
+	NO_RENUMBERING,
+	HILBERT_RENUMBERING,
+	KD_TREE_RENUMBERING
+};
+
+//Holds the settings parsed from the command line. The input file name is
+//always the first argument, and any of the optional flags below may follow
+//it (e.g. './greedyTSP_w2Opt file.txt --target-gap 5').
+struct SolverOptions{
+	char* dataInputFileName;
+	bool computeHeldKarpBound;		//--held-karp
+	double targetGapPercent;		//--target-gap <percent> (negative if not set)
+	TourConstructor tourConstructor;	//--constructor <name>
+	CityRenumbering renumbering;		//--renumber <order>
+	TwoOptMode twoOptMode;			//--two-opt <mode>
+	double annealSeconds;			//--anneal <seconds> (0 if not set)
+	int replicaCount;				//--replicas <count> (0 = one per core)
+	unsigned seed;					//--seed <number>
+	int independentRuns;			//--independent-runs <count>
+	std::vector<char*> mergeTourFiles;	//--merge <file.tour> (repeatable)
+	double memoryLimitBytes;		//--memory-limit <size> (0 = detect, see executionPlanner.cpp)
+	double timeBudgetSeconds;		//--time-budget <seconds>
+	bool exactSolution;				//--exact (see exactSolver.cpp)
+	BulkPages bulkPages;			//--bulk-memory <pages> (see bulkMemory.cpp)
+	NumaPlacement numaPlacement;	//--numa <placement>
+	SolverOptions()
+	{
+		dataInputFileName = nullptr;
+		computeHeldKarpBound = false;
+		targetGapPercent = -1;
+		tourConstructor = PROGRAM_CONSTRUCTOR;
+		renumbering = NO_RENUMBERING;
+		twoOptMode = FIRST_IMPROVEMENT;
+		annealSeconds = 0;
+		replicaCount = 0;
+		seed = 1;
+		independentRuns = 1;
+		memoryLimitBytes = 0;
+		timeBudgetSeconds = 60;
+		exactSolution = false;
+		bulkPages = STANDARD_ALLOCATOR;
+		numaPlacement = FIRST_TOUCH;
+	}
+};
+
+SolverOptions parseSolverOptions(int argc, char *argv[]);
+
+#endif
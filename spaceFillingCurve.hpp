@@ -0,0 +1,42 @@
+/******************************************************************************
+** Program name: spaceFillingCurve.hpp
+** Class name: CS325-400
+** Author: Ben Fridkis
+** Date: 10/18/2026
+** Description: Declarations for the Hilbert (space-filling) curve tour
+**				constructor.
+*******************************************************************************/
+
+#ifndef SPACE_FILLING_CURVE_HPP
+#define SPACE_FILLING_CURVE_HPP
+
+#include <vector>
+#include <tuple>
+#include <algorithm>
+#include "tspCities.hpp"
+#include "tspMetrics.hpp"
+
+unsigned hilbertIndex(unsigned x, unsigned y);
+
+std::vector<int> hilbertOrder(const std::vector<City>& cities);
+
+/**************************************************************************************
+**                                loadHilbertTour                                    **
+** This function returns a tuple with the total tour distance('<0>' of tuple) and a  **
+** vector of cities ('<1>' of tuple) in Hilbert curve order. As with the other tour  **
+** constructors, the tour is rotated to begin at city 0.                             **
+**************************************************************************************/
+template <class Distance>
+std::tuple<int, std::vector<int>> loadHilbertTour(const std::vector<City>& cities,
+                                                  const Distance& distance)
+{
+	std::tuple<int, std::vector<int>> tspTour;
+	std::get<1>(tspTour) = hilbertOrder(cities);
+	std::vector<int>& tour = std::get<1>(tspTour);
+	std::rotate(tour.begin(), std::find(tour.begin(), tour.end(), 0), tour.end());
+	std::get<0>(tspTour) = tourLength(tour, distance);
+
+	return tspTour;
+}
+
+#endif
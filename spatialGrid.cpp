@@ -0,0 +1,274 @@
+/******************************************************************************
+** Program name: spatialGrid.cpp
+** Class name: CS325-400
+** Author: Ben Fridkis
+** Date: 10/18/2026
+** Description: Uniform grid spatial index. The bounding box of the map is
+**				cut into square cells holding about two cities each, stored
+**				as one array of city indices ordered by cell (the same layout
+**				as a counting sort). A nearest neighbor search scans the
+**				query city's cell and then rings of cells around it, and
+**				stops once no unscanned cell can hold a closer city, so for
+**				reasonably spread out inputs a query costs O(k) rather than
+**				O(n).
+*******************************************************************************/
+
+#include "spatialGrid.hpp"
+#include <vector>
+#include <queue>
+#include <utility>
+#include <algorithm>
+#include <cmath>
+using std::vector;
+using std::pair;
+using std::make_pair;
+using std::priority_queue;
+
+//Average number of cities per grid cell.
+static const double CITIES_PER_CELL = 2.0;
+
+//Returns the squared straight-line distance between two cities.
+static inline double squaredDistance(const City& a, const City& b)
+{
+	double dx = a.x - b.x;
+	double dy = a.y - b.y;
+	return dx * dx + dy * dy;
+}
+
+/**************************************************************************************
+**                                  SpatialGrid                                      **
+** Builds the grid over the bounding box of cities. Every city starts out active.    **
+**************************************************************************************/
+SpatialGrid::SpatialGrid(const vector<City>& c) : cities(&c)
+{
+	int cityCount = static_cast<int>(c.size());
+	minX = cityCount > 0 ? c[0].x : 0;
+	minY = cityCount > 0 ? c[0].y : 0;
+	double maxX = minX, maxY = minY;
+	for(int i = 1; i < cityCount; i++)
+	{
+		minX = std::min(minX, c[i].x);
+		maxX = std::max(maxX, c[i].x);
+		minY = std::min(minY, c[i].y);
+		maxY = std::max(maxY, c[i].y);
+	}
+	double width = maxX - minX, height = maxY - minY;
+	double cellsWanted = std::max(1.0, cityCount / CITIES_PER_CELL);
+	cellSize = std::sqrt(width * height / cellsWanted);
+	if(cellSize <= 0)
+	{
+		//(All cities on a line, or all on one point.)
+		cellSize = std::max(width, height) / cellsWanted;
+		if(cellSize <= 0)
+		{
+			cellSize = 1;
+		}
+	}
+	columns = static_cast<int>(width / cellSize) + 1;
+	rows = static_cast<int>(height / cellSize) + 1;
+
+	//Count the cities per cell, turn the counts into starting positions, then
+	//place each city.
+	int cellCount = columns * rows;
+	cellStart.assign(cellCount + 1, 0);
+	BulkVector<int> cellOf(cityCount);
+	for(int i = 0; i < cityCount; i++)
+	{
+		cellOf[i] = cellIndex(c[i].x, c[i].y);
+		cellStart[cellOf[i] + 1]++;
+	}
+	for(int cell = 0; cell < cellCount; cell++)
+	{
+		cellStart[cell + 1] += cellStart[cell];
+	}
+	activeCount.assign(cellCount, 0);
+	cellCities.resize(cityCount);
+	slot.resize(cityCount);
+	for(int i = 0; i < cityCount; i++)
+	{
+		int cell = cellOf[i];
+		slot[i] = cellStart[cell] + activeCount[cell]++;
+		cellCities[slot[i]] = i;
+	}
+}
+
+//Returns the cell holding point (x, y).
+int SpatialGrid::cellIndex(double x, double y) const
+{
+	int column = std::min(columns - 1, std::max(0, static_cast<int>((x - minX) / cellSize)));
+	int row = std::min(rows - 1, std::max(0, static_cast<int>((y - minY) / cellSize)));
+	return row * columns + column;
+}
+
+//Appends to cells every cell on the square ring of radius r around (column, row).
+static void ringCells(int column, int row, int r, int columns, int rows, vector<int>& cells)
+{
+	cells.clear();
+	for(int y = row - r; y <= row + r; y++)
+	{
+		if(y < 0 || y >= rows)
+		{
+			continue;
+		}
+		int step = (y == row - r || y == row + r) ? 1 : 2 * r;
+		for(int x = column - r; x <= column + r; x += step)
+		{
+			if(x >= 0 && x < columns)
+			{
+				cells.push_back(y * columns + x);
+			}
+		}
+	}
+}
+
+/**************************************************************************************
+**                                nearestNeighbors                                   **
+** Returns the (up to) k cities closest to city, in order of increasing distance,    **
+** whether or not they are active. After scanning ring r, every unscanned city is at **
+** least r * cellSize away, so the search stops as soon as the k'th closest city     **
+** found so far is nearer than that.                                                 **
+**************************************************************************************/
+vector<int> SpatialGrid::nearestNeighbors(int city, int k) const
+{
+	const City& from = (*cities)[city];
+	int cell = cellIndex(from.x, from.y);
+	int column = cell % columns, row = cell / columns;
+	priority_queue<pair<double, int>> best;		//(max-heap: farthest kept city on top)
+	vector<int> cells;
+	for(int r = 0; r <= std::max(columns, rows); r++)
+	{
+		ringCells(column, row, r, columns, rows, cells);
+		for(int i = 0; i < static_cast<int>(cells.size()); i++)
+		{
+			for(int s = cellStart[cells[i]]; s < cellStart[cells[i] + 1]; s++)
+			{
+				int other = cellCities[s];
+				if(other == city)
+				{
+					continue;
+				}
+				double d = squaredDistance(from, (*cities)[other]);
+				if(static_cast<int>(best.size()) < k)
+				{
+					best.push(make_pair(d, other));
+				}
+				else if(d < best.top().first)
+				{
+					best.pop();
+					best.push(make_pair(d, other));
+				}
+			}
+		}
+		double reach = r * cellSize;
+		if(static_cast<int>(best.size()) == k && best.top().first <= reach * reach)
+		{
+			break;
+		}
+	}
+	vector<int> neighbors(best.size());
+	for(int i = static_cast<int>(neighbors.size()) - 1; i >= 0; i--)
+	{
+		neighbors[i] = best.top().second;
+		best.pop();
+	}
+	return neighbors;
+}
+
+/**************************************************************************************
+**                                 nearestActive                                     **
+** Returns the active city (other than city itself) closest to city, or -1 if there  **
+** is none. Same ring search as nearestNeighbors with k = 1.                         **
+**************************************************************************************/
+int SpatialGrid::nearestActive(int city) const
+{
+	const City& from = (*cities)[city];
+	int cell = cellIndex(from.x, from.y);
+	int column = cell % columns, row = cell / columns;
+	int nearest = -1;
+	double nearestDistance = 0;
+	vector<int> cells;
+	for(int r = 0; r <= std::max(columns, rows); r++)
+	{
+		ringCells(column, row, r, columns, rows, cells);
+		for(int i = 0; i < static_cast<int>(cells.size()); i++)
+		{
+			for(int s = cellStart[cells[i]]; s < cellStart[cells[i]] + activeCount[cells[i]]; s++)
+			{
+				int other = cellCities[s];
+				double d = squaredDistance(from, (*cities)[other]);
+				if(other != city && (nearest == -1 || d < nearestDistance))
+				{
+					nearest = other;
+					nearestDistance = d;
+				}
+			}
+		}
+		double reach = r * cellSize;
+		if(nearest != -1 && nearestDistance <= reach * reach)
+		{
+			break;
+		}
+	}
+	return nearest;
+}
+
+//Removes city from the results of nearestActive, by swapping it behind the
+//active cities of its cell.
+void SpatialGrid::deactivate(int city)
+{
+	const City& c = (*cities)[city];
+	int cell = cellIndex(c.x, c.y);
+	int lastActive = cellStart[cell] + activeCount[cell] - 1;
+	if(slot[city] > lastActive)
+	{
+		return;		//(Already inactive.)
+	}
+	int other = cellCities[lastActive];
+	std::swap(cellCities[slot[city]], cellCities[lastActive]);
+	slot[other] = slot[city];
+	slot[city] = lastActive;
+	activeCount[cell]--;
+}
+
+//Returns city to the results of nearestActive, by swapping it to the front of
+//the inactive cities of its cell.
+void SpatialGrid::activate(int city)
+{
+	const City& c = (*cities)[city];
+	int cell = cellIndex(c.x, c.y);
+	int firstInactive = cellStart[cell] + activeCount[cell];
+	if(slot[city] < firstInactive)
+	{
+		return;		//(Already active.)
+	}
+	int other = cellCities[firstInactive];
+	std::swap(cellCities[slot[city]], cellCities[firstInactive]);
+	slot[other] = slot[city];
+	slot[city] = firstInactive;
+	activeCount[cell]++;
+}
+
+/**************************************************************************************
+**                              nearestNeighborLists                                 **
+** Returns the candidate lists (the candidatesPerCity closest cities to each city,   **
+** closest first) computed with a SpatialGrid, in about O(n k) time instead of the   **
+** O(n^2) of buildCandidateLists. The lists are by straight-line distance, which     **
+** orders neighbors the same way as every coordinate metric except GEO (where it is  **
+** close enough for candidate lists).                                                **
+**************************************************************************************/
+vector<vector<int>> nearestNeighborLists(const vector<City>& cities, int candidatesPerCity)
+{
+	int cityCount = static_cast<int>(cities.size());
+	vector<vector<int>> candidates(cityCount);
+	int k = std::min(candidatesPerCity, cityCount - 1);
+	if(k <= 0)
+	{
+		return candidates;
+	}
+	SpatialGrid grid(cities);
+	for(int i = 0; i < cityCount; i++)
+	{
+		candidates[i] = grid.nearestNeighbors(i, k);
+	}
+	return candidates;
+}
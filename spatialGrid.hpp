@@ -0,0 +1,44 @@
+/******************************************************************************
+** Program name: spatialGrid.hpp
+** Class name: CS325-400
+** Author: Ben Fridkis
+** Date: 10/18/2026
+** Description: Declarations for the uniform grid spatial index used to find
+**				nearest neighbors without computing all n^2 distances.
+*******************************************************************************/
+
+#ifndef SPATIAL_GRID_HPP
+#define SPATIAL_GRID_HPP
+
+#include <vector>
+#include "tspCities.hpp"
+#include "bulkMemory.hpp"
+
+//Buckets the cities into square cells (about two cities per cell) and answers
+//nearest neighbor queries by searching rings of cells outward from a city.
+//Distances are straight-line distances between the coordinates. Cities can be
+//deactivated, after which nearestActive no longer returns them, and activated
+//again. (Its arrays are bulk arrays, see bulkMemory.cpp.)
+class SpatialGrid
+{
+public:
+	explicit SpatialGrid(const std::vector<City>& cities);
+	std::vector<int> nearestNeighbors(int city, int k) const;
+	int nearestActive(int city) const;
+	void deactivate(int city);
+	void activate(int city);
+private:
+	int cellIndex(double x, double y) const;
+	const std::vector<City>* cities;
+	double minX, minY, cellSize;
+	int columns, rows;
+	BulkVector<int> cellStart;		//Cities of cell c are cellCities[cellStart[c] .. cellStart[c + 1])
+	BulkVector<int> activeCount;	//(the active ones first)
+	BulkVector<int> cellCities;
+	BulkVector<int> slot;			//Position of each city in cellCities
+};
+
+std::vector<std::vector<int>> nearestNeighborLists(const std::vector<City>& cities,
+                                                   int candidatesPerCity);
+
+#endif
@@ -0,0 +1,248 @@
+/******************************************************************************
+** Program name: steepestTwoOpt.cpp
+** Class name: CS325-400
+** Author: Ben Fridkis
+** Date: 10/18/2026
+** Description: Steepest descent 2-Opt. twoOptImprove takes the first
+**				improving swap it finds and, when restarting, scans the
+**				tour again from the start, re-evaluating the same pairs
+**				that did not improve it last time. Here every city keeps its
+**				best move (replacing its tour edge and that of a city on its
+**				candidate list) in a priority queue ordered by gain, and the
+**				best move of all is applied. A move changes the tour edges
+**				of only its four endpoints, so only their best moves are
+**				recomputed; queued moves whose edges have gone since are
+**				recomputed when they reach the top. The tour is stored with
+**				the position of each city, so a move costs O(k) evaluations
+**				plus the reversal of the shorter side of the tour.
+*******************************************************************************/
+
+#include "steepestTwoOpt.hpp"
+#include "tspMetrics.hpp"
+#include "bulkMemory.hpp"
+#include <vector>
+#include <tuple>
+#include <queue>
+#include <algorithm>
+using std::vector;
+using std::tuple;
+using std::get;
+using std::priority_queue;
+
+//Replacing tour edges (a, nextA) and (b, nextB) by (a, b) and (nextA, nextB),
+//where nextA and nextB both follow (or both precede) a and b on the tour.
+//version is a's move count when it was evaluated (see SteepestDescent).
+struct TwoOptMove{
+	int gain;
+	int a;
+	int nextA;
+	int b;
+	int nextB;
+	int version;
+	bool operator<(const TwoOptMove& other) const
+	{
+		if(gain != other.gain) return gain < other.gain;
+		if(a != other.a) return a > other.a;
+		return b > other.b;
+	}
+};
+
+//The tour being improved, with each city's position, and the queue of best moves.
+//(The per-city arrays and the queue are bulk arrays, see bulkMemory.cpp.)
+template <class Distance>
+class SteepestDescent
+{
+public:
+	SteepestDescent(vector<int>& t, const Distance& d, const vector<vector<int>>& candidates)
+		: tour(t), position(t.size()), version(t.size(), 0), distance(&d), neighbors(candidates)
+	{
+		int n = static_cast<int>(tour.size());
+		for(int i = 0; i < n; i++)
+		{
+			position[tour[i]] = i;
+		}
+		//(A move found from either of its cities is the same move, so each city
+		//looks at the cities listing it as well as its own candidates.)
+		for(int i = 0; i < n; i++)
+		{
+			for(int j = 0; j < static_cast<int>(candidates[i].size()); j++)
+			{
+				neighbors[candidates[i][j]].push_back(i);
+			}
+		}
+		for(int i = 0; i < n; i++)
+		{
+			std::sort(neighbors[i].begin(), neighbors[i].end());
+			neighbors[i].erase(std::unique(neighbors[i].begin(), neighbors[i].end()), neighbors[i].end());
+		}
+	}
+
+	//Queues every city's best move. Returns false if none improves the tour.
+	bool queueAll()
+	{
+		for(int c = 0; c < static_cast<int>(tour.size()); c++)
+		{
+			queueBest(c);
+		}
+		return !moves.empty();
+	}
+
+	//Applies queued moves, best first, until none is left or the tour length
+	//reaches targetDistance. Returns the total gain.
+	int descend(int length, int targetDistance)
+	{
+		int gained = 0;
+		while(!moves.empty() && length - gained > targetDistance)
+		{
+			TwoOptMove move = moves.top();
+			moves.pop();
+			if(move.version != version[move.a])
+			{
+				continue;		//(Superseded by a newer move of a.)
+			}
+			if(!current(move))
+			{
+				queueBest(move.a);
+				continue;
+			}
+			apply(move);
+			gained += move.gain;
+			queueBest(move.a);
+			queueBest(move.nextA);
+			queueBest(move.b);
+			queueBest(move.nextB);
+		}
+		return gained;
+	}
+
+private:
+	int successor(int city) const
+	{
+		int n = static_cast<int>(tour.size());
+		return tour[(position[city] + 1) % n];
+	}
+	int predecessor(int city) const
+	{
+		int n = static_cast<int>(tour.size());
+		return tour[(position[city] + n - 1) % n];
+	}
+
+	//Queues the best improving move of city (if any), superseding its queued one.
+	void queueBest(int city)
+	{
+		version[city]++;
+		TwoOptMove best;
+		best.gain = 0;
+		const vector<int>& list = neighbors[city];
+		for(int side = 0; side < 2; side++)
+		{
+			int next = side == 0 ? successor(city) : predecessor(city);
+			int removed = (*distance)(city, next);
+			for(int j = 0; j < static_cast<int>(list.size()); j++)
+			{
+				int other = list[j];
+				int otherNext = side == 0 ? successor(other) : predecessor(other);
+				//(A move between adjacent edges gains nothing, so is never taken.)
+				int gain = removed + (*distance)(other, otherNext) -
+				           (*distance)(city, other) - (*distance)(next, otherNext);
+				if(gain > best.gain)
+				{
+					best.gain = gain;
+					best.a = city;
+					best.nextA = next;
+					best.b = other;
+					best.nextB = otherNext;
+				}
+			}
+		}
+		if(best.gain > 0)
+		{
+			best.version = version[city];
+			moves.push(best);
+		}
+	}
+
+	//Returns true if both of move's edges are still on the tour, in the same
+	//direction (so its gain is unchanged).
+	bool current(const TwoOptMove& move) const
+	{
+		return (successor(move.a) == move.nextA && successor(move.b) == move.nextB) ||
+		       (predecessor(move.a) == move.nextA && predecessor(move.b) == move.nextB);
+	}
+
+	void apply(const TwoOptMove& move)
+	{
+		if(successor(move.a) == move.nextA)
+		{
+			reversePath(position[move.nextA], position[move.b]);
+		}
+		else
+		{
+			reversePath(position[move.a], position[move.nextB]);
+		}
+	}
+
+	//Reverses the cities at tour positions from..to (inclusive, going forward),
+	//or the complementary path if it is shorter (see reversePath in
+	//simulatedAnnealing.cpp).
+	void reversePath(int from, int to)
+	{
+		int n = static_cast<int>(tour.size());
+		int length = (to - from + n) % n + 1;
+		if(2 * length > n)
+		{
+			int newFrom = (to + 1) % n;
+			to = (from + n - 1) % n;
+			from = newFrom;
+			length = n - length;
+		}
+		for(int k = 0; k < length / 2; k++)
+		{
+			int i = (from + k) % n;
+			int j = (to - k + n) % n;
+			std::swap(tour[i], tour[j]);
+			position[tour[i]] = i;
+			position[tour[j]] = j;
+		}
+	}
+
+	vector<int>& tour;
+	BulkVector<int> position;
+	BulkVector<int> version;		//Moves evaluated per city (older queued moves are dropped)
+	const Distance* distance;
+	vector<vector<int>> neighbors;
+	priority_queue<TwoOptMove, BulkVector<TwoOptMove>> moves;
+};
+
+/**************************************************************************************
+**                              steepestTwoOptImprove                                **
+** This function receives a tour tuple (tsp solution), the distances and the         **
+** candidate lists, and improves the tour by 2-Opt moves on the candidate lists,     **
+** always applying the move that shortens the tour the most. Once the queue runs     **
+** dry, every city's best move is checked again (moves passed over while their edges **
+** were being changed are found this way), and improvement stops when no move on the **
+** candidate lists helps or the tour distance is at or below targetDistance. The     **
+** tour still begins at city 0.                                                      **
+**************************************************************************************/
+template <class Distance>
+void steepestTwoOptImprove(tuple<int, vector<int>> &tspTour, const Distance& graph,
+                           const vector<vector<int>> &candidates, int targetDistance)
+{
+	vector<int>& tour = get<1>(tspTour);
+	if(tour.size() < 4 || get<0>(tspTour) <= targetDistance)
+	{
+		return;
+	}
+	SteepestDescent<Distance> descent(tour, graph, candidates);
+	while(get<0>(tspTour) > targetDistance && descent.queueAll())
+	{
+		get<0>(tspTour) -= descent.descend(get<0>(tspTour), targetDistance);
+	}
+	std::rotate(tour.begin(), std::find(tour.begin(), tour.end(), 0), tour.end());
+}
+
+//(See FOR_EACH_DISTANCE_SOURCE in tspMetrics.hpp.)
+#define INSTANTIATE_STEEPEST_TWO_OPT(Distance) \
+	template void steepestTwoOptImprove<Distance>(tuple<int, vector<int>>&, const Distance&, \
+	                                              const vector<vector<int>>&, int);
+FOR_EACH_DISTANCE_SOURCE(INSTANTIATE_STEEPEST_TWO_OPT)
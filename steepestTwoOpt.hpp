@@ -0,0 +1,26 @@
+/******************************************************************************
+** Program name: steepestTwoOpt.hpp
+** Class name: CS325-400
+** Author: Ben Fridkis
+** Date: 10/18/2026
+** Description: Declarations for the steepest descent (best improvement)
+**				2-Opt mode, which applies the best move on the candidate
+**				lists each time, from a priority queue of move gains.
+*******************************************************************************/
+
+#ifndef STEEPEST_TWO_OPT_HPP
+#define STEEPEST_TWO_OPT_HPP
+
+#include <vector>
+#include <tuple>
+
+//(Defined in steepestTwoOpt.cpp for each distance source in tspMetrics.hpp.)
+//Improvement stops early once the tour distance is at or below targetDistance
+//(0 to run until no move on the candidate lists improves the tour).
+template <class Distance>
+void steepestTwoOptImprove(std::tuple<int, std::vector<int>> &tspTour,
+                           const Distance& graph,
+                           const std::vector<std::vector<int>> &candidates,
+                           int targetDistance);
+
+#endif
@@ -0,0 +1,150 @@
+/******************************************************************************
+** Program name: streamingCheck.cpp
+** Class name: CS325-400
+** Author: Ben Fridkis
+** Date: 10/18/2026
+** Description: Checks that the distances of a plain EUC_2D instance (the
+**				course format, "city x y" per line) are computed while the
+**				input is still being read. The cities are written into a
+**				FIFO by another thread, which stops after the first chunk
+**				and only writes the rest once the distance rows of that
+**				chunk are done (or a time limit passes). The check fails if
+**				the planner would not stream this instance, if the rows
+**				were not done before the end of the input, if the streamed
+**				matrix is not complete and correct, or if the plan does not
+**				use it.
+*******************************************************************************/
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <string>
+#include <random>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "tsplibReader.hpp"
+#include "cityStream.hpp"
+#include "executionPlanner.hpp"
+#include "solverOptions.hpp"
+using std::vector;
+using std::string;
+using std::cout;
+using std::endl;
+
+static const int CITY_COUNT = 1500;
+static const int CITIES_BEFORE_PAUSE = 1000;	//(More than one chunk, see cityStream.cpp.)
+static const double PAUSE_LIMIT_SECONDS = 60;
+
+//Returns the course format lines of cityCount seeded random cities.
+static vector<string> randomCityLines(int cityCount)
+{
+	std::mt19937 random(325);
+	std::uniform_int_distribution<int> coordinate(0, 100000);
+	vector<string> lines;
+	for(int i = 0; i < cityCount; i++)
+	{
+		std::ostringstream line;
+		line << i << " " << coordinate(random) << " " << coordinate(random) << "\n";
+		lines.push_back(line.str());
+	}
+	return lines;
+}
+
+//Writes lines into the FIFO, pausing after CITIES_BEFORE_PAUSE of them until
+//rowsStreamed is nonzero. Sets overlapped if it was before the rest was written.
+static void writeCities(const char* fifoName, const vector<string>& lines,
+                        const std::atomic<int>& rowsStreamed, std::atomic<bool>& overlapped)
+{
+	std::ofstream fifo(fifoName);
+	for(int i = 0; i < CITIES_BEFORE_PAUSE; i++)
+	{
+		fifo << lines[i];
+	}
+	fifo.flush();
+	std::chrono::steady_clock::time_point pause = std::chrono::steady_clock::now();
+	while(rowsStreamed.load() == 0 &&
+	      std::chrono::duration<double>(std::chrono::steady_clock::now() - pause).count() <
+	      PAUSE_LIMIT_SECONDS)
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	}
+	overlapped = rowsStreamed.load() > 0;
+	for(int i = CITIES_BEFORE_PAUSE; i < static_cast<int>(lines.size()); i++)
+	{
+		fifo << lines[i];
+	}
+}
+
+int main()
+{
+	SolverOptions options;
+	double byteLimit = streamedDistanceBytes(EUC_2D, GREEDY_EDGE_HEAP, options);
+	double needed = 2.0 * CITY_COUNT * (CITY_COUNT - 1);
+	cout << "Distances are streamed for plain EUC_2D input up to "
+	     << static_cast<long long>(byteLimit) << " bytes." << endl;
+	if(byteLimit < needed)
+	{
+		cout << "The planner does not stream " << CITY_COUNT << " cities." << endl;
+		return 1;
+	}
+
+	char fifoName[64];
+	snprintf(fifoName, sizeof(fifoName), "/tmp/streamingCheck.%d", static_cast<int>(getpid()));
+	if(mkfifo(fifoName, 0600) != 0)
+	{
+		cout << "Cannot create the FIFO " << fifoName << "." << endl;
+		return 1;
+	}
+	vector<string> lines = randomCityLines(CITY_COUNT);
+	std::atomic<int> rowsStreamed(0);
+	std::atomic<bool> overlapped(false);
+	std::thread writer(writeCities, fifoName, std::cref(lines), std::cref(rowsStreamed),
+	                   std::ref(overlapped));
+
+	//The same setup as runTourSolver (solverDriver.cpp), counting the rows done.
+	StreamedDistances streamed;
+	StreamSetup setup = [&](EdgeWeightType edgeWeightType, int expectedCities) -> vector<ChunkConsumer>
+	{
+		vector<ChunkConsumer> consumers;
+		ChunkConsumer tiles = distanceTileConsumer(edgeWeightType, expectedCities, byteLimit, streamed);
+		consumers.push_back([&rowsStreamed, tiles](const vector<City>& chunk, int firstCity)
+		{
+			tiles(chunk, firstCity);
+			rowsStreamed = firstCity + static_cast<int>(chunk.size());
+		});
+		return consumers;
+	};
+	TspInstance instance = loadTspInstance(fifoName, setup);
+	writer.join();
+	unlink(fifoName);
+
+	int cityCount = static_cast<int>(instance.cities.size());
+	bool matches = streamed.matches(instance.cities);
+	int wrong = 0;
+	if(matches)
+	{
+		CoordinateDistance<Euclidean2D> distance(instance.cities);
+		TriangularMatrixDistance triangle(streamed.weights);
+		for(int a = 0; a < cityCount; a++)
+		{
+			for(int b = 0; b < cityCount; b++)
+			{
+				wrong += triangle(a, b) != distance(a, b);
+			}
+		}
+	}
+	ExecutionPlan plan = planExecution(cityCount, instance.edgeWeightType, GREEDY_EDGE_HEAP, options,
+	                                   matches);
+
+	cout << cityCount << " cities, rows streamed before the end of the input: "
+	     << (overlapped ? "yes" : "no") << ", streamed matrix complete: " << (matches ? "yes" : "no")
+	     << ", wrong distances: " << wrong << ", plan stores a matrix: "
+	     << (plan.distanceStorage != ON_DEMAND ? "yes" : "no") << "." << endl;
+	return cityCount == CITY_COUNT && overlapped && matches && wrong == 0 &&
+	       plan.distanceStorage != ON_DEMAND ? 0 : 1;
+}
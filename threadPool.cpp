@@ -0,0 +1,99 @@
+/******************************************************************************
+** Program name: threadPool.cpp
+** Class name: CS325-400
+** Author: Ben Fridkis
+** Date: 10/18/2026
+** Description: Implementation of ThreadPool (see threadPool.hpp).
+*******************************************************************************/
+
+#include "threadPool.hpp"
+#include <algorithm>
+using std::function;
+using std::thread;
+using std::mutex;
+using std::unique_lock;
+
+//Starts threadCount worker threads (at least one).
+ThreadPool::ThreadPool(int threadCount)
+{
+	unfinished = 0;
+	stopping = false;
+	for(int i = 0; i < std::max(1, threadCount); i++)
+	{
+		workers.push_back(thread(&ThreadPool::workerLoop, this));
+	}
+}
+
+//Lets the workers finish any queued tasks, then joins them.
+ThreadPool::~ThreadPool()
+{
+	{
+		unique_lock<mutex> guard(lock);
+		stopping = true;
+	}
+	taskReady.notify_all();
+	for(int i = 0; i < static_cast<int>(workers.size()); i++)
+	{
+		workers[i].join();
+	}
+}
+
+void ThreadPool::submit(function<void()> task)
+{
+	{
+		unique_lock<mutex> guard(lock);
+		tasks.push(task);
+		unfinished++;
+	}
+	taskReady.notify_one();
+}
+
+//Blocks until every task submitted so far has finished.
+void ThreadPool::wait()
+{
+	unique_lock<mutex> guard(lock);
+	while(unfinished > 0)
+	{
+		allDone.wait(guard);
+	}
+}
+
+int ThreadPool::size() const
+{
+	return static_cast<int>(workers.size());
+}
+
+//Returns the number of hardware threads (1 if it cannot be determined).
+int ThreadPool::defaultThreadCount()
+{
+	return std::max(1, static_cast<int>(thread::hardware_concurrency()));
+}
+
+void ThreadPool::workerLoop()
+{
+	for(;;)
+	{
+		function<void()> task;
+		{
+			unique_lock<mutex> guard(lock);
+			while(tasks.empty() && !stopping)
+			{
+				taskReady.wait(guard);
+			}
+			if(tasks.empty())
+			{
+				return;		//(Stopping and nothing left to do.)
+			}
+			task = tasks.front();
+			tasks.pop();
+		}
+		task();
+		{
+			unique_lock<mutex> guard(lock);
+			if(--unfinished == 0)
+			{
+				allDone.notify_all();
+			}
+		}
+	}
+}
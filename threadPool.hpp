@@ -0,0 +1,48 @@
+/******************************************************************************
+** Program name: threadPool.hpp
+** Class name: CS325-400
+** Author: Ben Fridkis
+** Date: 10/18/2026
+** Description: A fixed-size pool of worker threads. Tasks are submitted as
+**				std::function<void()> and wait() blocks until every submitted
+**				task has finished, so work can be run in rounds.
+*******************************************************************************/
+
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+#include <vector>
+#include <queue>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+class ThreadPool
+{
+public:
+	explicit ThreadPool(int threadCount);
+	~ThreadPool();
+	void submit(std::function<void()> task);
+	void wait();
+	int size() const;
+
+	static int defaultThreadCount();
+
+private:
+	void workerLoop();
+
+	std::vector<std::thread> workers;
+	std::queue<std::function<void()>> tasks;
+	std::mutex lock;
+	std::condition_variable taskReady;
+	std::condition_variable allDone;
+	int unfinished;		//Tasks submitted but not yet finished.
+	bool stopping;
+
+	//(Not copyable.)
+	ThreadPool(const ThreadPool&);
+	ThreadPool& operator=(const ThreadPool&);
+};
+
+#endif
@@ -0,0 +1,366 @@
+/******************************************************************************
+** Program name: tourMerging.cpp
+** Class name: CS325-400
+** Author: Ben Fridkis
+** Date: 10/18/2026
+** Description: Tour merging by generalized partition crossover (GPX,
+**				Whitley, Hains & Howe, 2009). Two tours of the same cities
+**				usually share most of their edges. Removing the shared
+**				edges from the union of the two tours leaves a number of
+**				separate components, which each parent enters and leaves
+**				only through shared edges. If both parents pair up those
+**				entry and exit cities the same way inside a component, the
+**				child can take that component's paths from whichever parent
+**				is shorter there, independently of every other component.
+**				The child is therefore never longer than the better parent.
+*******************************************************************************/
+
+#include "tourMerging.hpp"
+#include "tspMetrics.hpp"
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <tuple>
+#include <utility>
+#include <algorithm>
+#include <cstdlib>
+using std::vector;
+using std::pair;
+using std::make_pair;
+using std::tuple;
+using std::get;
+using std::ifstream;
+using std::endl;
+
+/**************************************************************************************
+**                                  readTourFile                                     **
+** Reads a .tour file as written by these programs (the tour distance, then one city **
+** per line) and returns the cities in tour order. The file must visit each of the   **
+** cityCount cities exactly once.                                                    **
+**************************************************************************************/
+vector<int> readTourFile(char* tourFileName, int cityCount)
+{
+	ifstream inputData(tourFileName);
+	if(!inputData){
+        std::cerr << "\nTour file " << tourFileName << " cannot be found or opened.\n" << endl;
+        exit(1);
+    }
+	int distance;
+	inputData >> distance;		//(Recomputed by the caller, so not used.)
+	vector<int> tour;
+	vector<bool> visited(cityCount, false);
+	int city;
+	while(inputData >> city)
+	{
+		if(city < 0 || city >= cityCount || visited[city])
+		{
+			std::cerr << "\nTour file " << tourFileName << " is not a tour of this instance.\n" << endl;
+			exit(1);
+		}
+		visited[city] = true;
+		tour.push_back(city);
+	}
+	if(static_cast<int>(tour.size()) != cityCount)
+	{
+		std::cerr << "\nTour file " << tourFileName << " is not a tour of this instance.\n" << endl;
+		exit(1);
+	}
+	return tour;
+}
+
+//Union-find "find" with path halving.
+static int findSet(vector<int>& parent, int x)
+{
+	while(parent[x] != x)
+	{
+		parent[x] = parent[parent[x]];
+		x = parent[x];
+	}
+	return x;
+}
+
+//Fills neighbors[2 * c] and neighbors[2 * c + 1] with the two cities adjacent
+//to city c in the tour.
+static void tourNeighbors(const vector<int>& tour, vector<int>& neighbors)
+{
+	int n = static_cast<int>(tour.size());
+	neighbors.assign(2 * n, -1);
+	for(int i = 0; i < n; i++)
+	{
+		neighbors[2 * tour[i]] = tour[(i + n - 1) % n];
+		neighbors[2 * tour[i] + 1] = tour[(i + 1) % n];
+	}
+}
+
+/**************************************************************************************
+**                                 componentPaths                                    **
+** Walks a tour and, for each component, lists the (end city, end city) pairs of     **
+** the paths the tour takes through it, in sorted order. Two parents can be          **
+** exchanged inside a component exactly when these lists are equal. If one           **
+** component spans the whole tour (no path ends), every list is left empty.          **
+**************************************************************************************/
+static void componentPaths(const vector<int>& tour, const vector<int>& component,
+                           vector<vector<pair<int, int>>>& paths)
+{
+	int n = static_cast<int>(tour.size());
+	paths.assign(n, vector<pair<int, int>>());
+	int start = -1;		//A position where a path starts.
+	for(int i = 0; i < n && start == -1; i++)
+	{
+		if(component[tour[i]] != component[tour[(i + n - 1) % n]])
+		{
+			start = i;
+		}
+	}
+	if(start == -1)
+	{
+		return;
+	}
+	int pathStart = -1;
+	for(int k = 0; k < n; k++)
+	{
+		int city = tour[(start + k) % n];
+		int c = component[city];
+		if(c != component[tour[(start + k + n - 1) % n]])
+		{
+			pathStart = city;
+		}
+		if(c != component[tour[(start + k + 1) % n]] && c != -1)
+		{
+			paths[c].push_back(make_pair(std::min(pathStart, city), std::max(pathStart, city)));
+		}
+	}
+	for(int c = 0; c < n; c++)
+	{
+		std::sort(paths[c].begin(), paths[c].end());
+	}
+}
+
+/**************************************************************************************
+**                               partitionCrossover                                  **
+** This function returns the child tour (tuple of distance and cities, like the      **
+** other tour functions) of two parent tours:                                        **
+**   1. The edges of both parents that are not shared are grouped into connected     **
+**      components (union-find).                                                     **
+**   2. A component is "feasible" if both parents pass through it as paths with the  **
+**      same pairs of end cities (see componentPaths).                               **
+**   3. The child starts as whichever parent is shorter over the infeasible          **
+**      components, and each feasible component is then taken from whichever parent  **
+**      is shorter inside it.                                                        **
+** The child is walked once to confirm it is a single cycle; if not (which the       **
+** argument above rules out, but it is cheap to check), the better parent is         **
+** returned. The child starts at the same city as parentA.                           **
+**************************************************************************************/
+template <class Distance>
+tuple<int, vector<int>> partitionCrossover(const tuple<int, vector<int>>& parentA,
+                                           const tuple<int, vector<int>>& parentB,
+                                           const Distance& graph)
+{
+	const tuple<int, vector<int>>& better = get<0>(parentA) <= get<0>(parentB) ? parentA : parentB;
+	int n = static_cast<int>(get<1>(parentA).size());
+	if(n < 4 || static_cast<int>(get<1>(parentB).size()) != n)
+	{
+		return better;
+	}
+	vector<int> neighborsA, neighborsB;
+	tourNeighbors(get<1>(parentA), neighborsA);
+	tourNeighbors(get<1>(parentB), neighborsB);
+
+	//shared[2 * c + k] is true if the k'th edge of city c in parent A is also in B.
+	//(An edge is in both tours exactly when its cities are neighbors in both.)
+	vector<bool> sharedA(2 * n), sharedB(2 * n);
+	for(int c = 0; c < n; c++)
+	{
+		for(int k = 0; k < 2; k++)
+		{
+			int a = neighborsA[2 * c + k], b = neighborsB[2 * c + k];
+			sharedA[2 * c + k] = a == neighborsB[2 * c] || a == neighborsB[2 * c + 1];
+			sharedB[2 * c + k] = b == neighborsA[2 * c] || b == neighborsA[2 * c + 1];
+		}
+	}
+
+	//Components of the unshared edges. Cities with only shared edges belong to no
+	//component (component -1).
+	vector<int> parent(n);
+	for(int c = 0; c < n; c++)
+	{
+		parent[c] = c;
+	}
+	for(int c = 0; c < n; c++)
+	{
+		for(int k = 0; k < 2; k++)
+		{
+			if(!sharedA[2 * c + k])
+			{
+				parent[findSet(parent, c)] = findSet(parent, neighborsA[2 * c + k]);
+			}
+			if(!sharedB[2 * c + k])
+			{
+				parent[findSet(parent, c)] = findSet(parent, neighborsB[2 * c + k]);
+			}
+		}
+	}
+	vector<int> component(n, -1);
+	for(int c = 0; c < n; c++)
+	{
+		if(!sharedA[2 * c] || !sharedA[2 * c + 1])
+		{
+			component[c] = findSet(parent, c);
+		}
+	}
+
+	//Each parent's length over its unshared edges, per component. (Counted from both
+	//ends, so doubled, which does not change which parent is shorter.)
+	vector<long long> lengthA(n, 0), lengthB(n, 0);
+	for(int c = 0; c < n; c++)
+	{
+		if(component[c] == -1)
+		{
+			continue;
+		}
+		for(int k = 0; k < 2; k++)
+		{
+			int a = neighborsA[2 * c + k], b = neighborsB[2 * c + k];
+			if(!sharedA[2 * c + k])
+			{
+				lengthA[component[c]] += graph(c, a);
+			}
+			if(!sharedB[2 * c + k])
+			{
+				lengthB[component[c]] += graph(c, b);
+			}
+		}
+	}
+
+	vector<vector<pair<int, int>>> pathsA, pathsB;
+	componentPaths(get<1>(parentA), component, pathsA);
+	componentPaths(get<1>(parentB), component, pathsB);
+	vector<bool> feasible(n, false);
+	for(int c = 0; c < n; c++)
+	{
+		feasible[c] = component[c] == c && !pathsA[c].empty() && pathsA[c] == pathsB[c];
+	}
+
+	//Infeasible components are all taken from one parent (the base), feasible
+	//ones from whichever parent is shorter inside them.
+	long long restA = 0, restB = 0;
+	for(int c = 0; c < n; c++)
+	{
+		if(component[c] == c && !feasible[c])
+		{
+			restA += lengthA[c];
+			restB += lengthB[c];
+		}
+	}
+	bool baseIsA = restA <= restB;
+	vector<bool> useA(n, baseIsA);
+	for(int c = 0; c < n; c++)
+	{
+		int root = component[c];
+		if(root != -1 && feasible[root])
+		{
+			useA[c] = lengthA[root] <= lengthB[root];
+		}
+	}
+
+	//Walk the child starting at parent A's first city.
+	tuple<int, vector<int>> child;
+	vector<int>& tour = get<1>(child);
+	int start = get<1>(parentA)[0];
+	int previous = -1, current = start;
+	long long distance = 0;
+	for(int i = 0; i < n; i++)
+	{
+		tour.push_back(current);
+		const vector<int>& neighbors = useA[current] ? neighborsA : neighborsB;
+		int next = neighbors[2 * current] != previous ? neighbors[2 * current] :
+		                                                neighbors[2 * current + 1];
+		distance += graph(current, next);
+		previous = current;
+		current = next;
+		if(current == start && i < n - 1)
+		{
+			return better;		//(Closed a cycle early; see above.)
+		}
+	}
+	if(current != start || distance > get<0>(better))
+	{
+		return better;
+	}
+	get<0>(child) = static_cast<int>(distance);
+	return child;
+}
+
+/**************************************************************************************
+**                                 mergeTourFiles                                    **
+** Merges tspTour with the tours in the given .tour files. The files number the      **
+** cities by input position, from 0; if the cities were renumbered (originalIds, the **
+** input position of each new id, is not empty), the tours are first mapped to the   **
+** new ids.                                                                          **
+**************************************************************************************/
+template <class Distance>
+void mergeTourFiles(tuple<int, vector<int>>& tspTour, const vector<char*>& tourFileNames,
+                    const Distance& graph, const vector<int>& originalIds)
+{
+	int n = static_cast<int>(get<1>(tspTour).size());
+	vector<int> newIds(n);
+	for(int i = 0; i < n; i++)
+	{
+		newIds[originalIds.empty() ? i : originalIds[i]] = i;
+	}
+	vector<tuple<int, vector<int>>> tours(1, tspTour);
+	for(int f = 0; f < static_cast<int>(tourFileNames.size()); f++)
+	{
+		vector<int> tour = readTourFile(tourFileNames[f], n);
+		int distance = 0;
+		for(int i = 0; i < n; i++)
+		{
+			tour[i] = newIds[tour[i]];
+			if(i > 0)
+			{
+				distance += graph(tour[i - 1], tour[i]);
+			}
+		}
+		distance += graph(tour[n - 1], tour[0]);
+		tours.push_back(std::make_tuple(distance, tour));
+	}
+	tspTour = mergeTours(tours, graph);
+}
+
+/**************************************************************************************
+**                                   mergeTours                                      **
+** Folds any number of tours into one: the shortest tour is crossed with each of the **
+** others in turn (shortest first), keeping the child each time.                     **
+**************************************************************************************/
+template <class Distance>
+tuple<int, vector<int>> mergeTours(const vector<tuple<int, vector<int>>>& tours,
+                                   const Distance& graph)
+{
+	vector<int> order;
+	for(int i = 0; i < static_cast<int>(tours.size()); i++)
+	{
+		order.push_back(i);
+	}
+	for(int i = 1; i < static_cast<int>(order.size()); i++)
+	{
+		for(int j = i; j > 0 && get<0>(tours[order[j]]) < get<0>(tours[order[j - 1]]); j--)
+		{
+			std::swap(order[j], order[j - 1]);
+		}
+	}
+	tuple<int, vector<int>> merged = tours[order[0]];
+	for(int i = 1; i < static_cast<int>(order.size()); i++)
+	{
+		merged = partitionCrossover(merged, tours[order[i]], graph);
+	}
+	return merged;
+}
+
+//(See FOR_EACH_DISTANCE_SOURCE in tspMetrics.hpp.)
+#define INSTANTIATE_TOUR_MERGING(Distance) \
+	template tuple<int, vector<int>> partitionCrossover<Distance>(const tuple<int, vector<int>>&, \
+	                                                              const tuple<int, vector<int>>&, const Distance&); \
+	template void mergeTourFiles<Distance>(tuple<int, vector<int>>&, const vector<char*>&, \
+	                                       const Distance&, const vector<int>&); \
+	template tuple<int, vector<int>> mergeTours<Distance>(const vector<tuple<int, vector<int>>>&, const Distance&);
+FOR_EACH_DISTANCE_SOURCE(INSTANTIATE_TOUR_MERGING)
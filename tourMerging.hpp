@@ -0,0 +1,33 @@
+/******************************************************************************
+** Program name: tourMerging.hpp
+** Class name: CS325-400
+** Author: Ben Fridkis
+** Date: 10/18/2026
+** Description: Declarations for merging several tours of the same instance
+**				into one by partition crossover.
+*******************************************************************************/
+
+#ifndef TOUR_MERGING_HPP
+#define TOUR_MERGING_HPP
+
+#include <vector>
+#include <tuple>
+
+std::vector<int> readTourFile(char* tourFileName, int cityCount);
+
+//(The templates are defined in tourMerging.cpp for each distance source in
+//tspMetrics.hpp.)
+template <class Distance>
+std::tuple<int, std::vector<int>> partitionCrossover(const std::tuple<int, std::vector<int>>& parentA,
+                                                     const std::tuple<int, std::vector<int>>& parentB,
+                                                     const Distance& graph);
+
+template <class Distance>
+std::tuple<int, std::vector<int>> mergeTours(const std::vector<std::tuple<int, std::vector<int>>>& tours,
+                                             const Distance& graph);
+
+template <class Distance>
+void mergeTourFiles(std::tuple<int, std::vector<int>>& tspTour, const std::vector<char*>& tourFileNames,
+                    const Distance& graph, const std::vector<int>& originalIds);
+
+#endif
@@ -0,0 +1,31 @@
+/******************************************************************************
+** Program name: tspCities.cpp
+** Class name: CS325-400
+** Author: Ben Fridkis
+** Date: 10/18/2026
+** Description: Loads the city coordinates of a TSP input into memory (one
+**				pass over the input, which may be a pipe). See
+**				tsplibReader.cpp for TSPLIB (.tsp) inputs.
+*******************************************************************************/
+
+#include "tspCities.hpp"
+#include "cityStream.hpp"
+#include <istream>
+#include <vector>
+using std::vector;
+
+/**************************************************************************************
+**                                  loadCities                                       **
+** This function returns a vector holding every city (id and coordinates) in the     **
+** order they appear in the input. Lines that are not "city x y" are skipped. Each   **
+** consumer gets the cities in chunks while the rest are still being read.           **
+**************************************************************************************/
+vector<City> loadCities(std::istream& inputData, const vector<ChunkConsumer>& consumers)
+{
+	CityStream stream(inputData, false);
+	for(int i = 0; i < static_cast<int>(consumers.size()); i++)
+	{
+		stream.addConsumer(consumers[i]);
+	}
+	return stream.run();
+}
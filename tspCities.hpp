@@ -0,0 +1,38 @@
+/******************************************************************************
+** Program name: tspCities.hpp
+** Class name: CS325-400
+** Author: Ben Fridkis
+** Date: 10/18/2026
+** Description: Declarations for loading the city coordinates of a TSP
+**				input ("city x y" per line) into memory.
+*******************************************************************************/
+
+#ifndef TSP_CITIES_HPP
+#define TSP_CITIES_HPP
+
+#include <vector>
+#include <istream>
+#include <functional>
+
+//Structure to represent a city (vertex) and its coordinates.
+struct City{
+	int id;
+	double x;
+	double y;
+	City(){};
+	City(int i, double cX, double cY)
+	{
+		id = i;
+		x = cX;
+		y = cY;
+	}
+};
+
+//Work done on each chunk of cities as it is read (see cityStream.cpp). Called on
+//the consumer's own thread, once per chunk and in input order; firstCity is the
+//index of chunk[0].
+typedef std::function<void(const std::vector<City>& chunk, int firstCity)> ChunkConsumer;
+
+std::vector<City> loadCities(std::istream& inputData, const std::vector<ChunkConsumer>& consumers);
+
+#endif
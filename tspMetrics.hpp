@@ -0,0 +1,236 @@
+/******************************************************************************
+** Program name: tspMetrics.hpp
+** Class name: CS325-400
+** Author: Ben Fridkis
+** Date: 10/18/2026
+** Description: Distance metrics (TSPLIB edge weight types) as compile-time
+**				policies. Each metric is a struct with a static (inline)
+**				distance function, and the loaders and 2-Opt are templates
+**				on a "distance source" (anything callable as distance(a, b)
+**				for city indices a and b). Each hot loop is therefore
+**				compiled once per metric with the metric inlined, rather
+**				than making a virtual or function pointer call for every
+**				distance. See TSPLIB 95, Reinelt (1995), section 2, for the
+**				metric definitions.
+*******************************************************************************/
+
+#ifndef TSP_METRICS_HPP
+#define TSP_METRICS_HPP
+
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include "tspCities.hpp"
+#include "bulkMemory.hpp"
+#include "threadPool.hpp"
+
+//TSPLIB edge weight types supported by the solvers.
+enum EdgeWeightType{
+	EUC_2D,			//Euclidean distance rounded to nearest integer (the .txt inputs)
+	CEIL_2D,		//Euclidean distance rounded up
+	ATT,			//Pseudo-Euclidean distance
+	GEO,			//Geographical (great circle) distance, coordinates as DDD.MM
+	EXPLICIT		//Distances given in the input file
+};
+
+//EUC_2D: Euclidean distance, rounded to the nearest integer.
+struct Euclidean2D{
+	static inline int distance(const City& a, const City& b)
+	{
+		double dx = a.x - b.x;
+		double dy = a.y - b.y;
+		return static_cast<int>(round(sqrt(dx * dx + dy * dy)));
+	}
+};
+
+//CEIL_2D: Euclidean distance, rounded up to the next integer.
+struct Ceiling2D{
+	static inline int distance(const City& a, const City& b)
+	{
+		double dx = a.x - b.x;
+		double dy = a.y - b.y;
+		return static_cast<int>(ceil(sqrt(dx * dx + dy * dy)));
+	}
+};
+
+//ATT: pseudo-Euclidean distance (used by the att48 and att532 instances).
+struct PseudoEuclidean{
+	static inline int distance(const City& a, const City& b)
+	{
+		double dx = a.x - b.x;
+		double dy = a.y - b.y;
+		double r = sqrt((dx * dx + dy * dy) / 10.0);
+		int t = static_cast<int>(round(r));
+		return t < r ? t + 1 : t;
+	}
+};
+
+//GEO: great circle distance in km on an idealized sphere. x is the latitude
+//and y the longitude, each given as DDD.MM (degrees.minutes).
+struct Geographical{
+	static inline double radians(double degreesMinutes)
+	{
+		const double PI = 3.141592;		//(The value TSPLIB specifies.)
+		int degrees = static_cast<int>(degreesMinutes);
+		double minutes = degreesMinutes - degrees;
+		return PI * (degrees + 5.0 * minutes / 3.0) / 180.0;
+	}
+	static inline int distance(const City& a, const City& b)
+	{
+		const double RRR = 6378.388;
+		double latitudeA = radians(a.x), longitudeA = radians(a.y);
+		double latitudeB = radians(b.x), longitudeB = radians(b.y);
+		double q1 = cos(longitudeA - longitudeB);
+		double q2 = cos(latitudeA - latitudeB);
+		double q3 = cos(latitudeA + latitudeB);
+		return static_cast<int>(RRR * acos(0.5 * ((1.0 + q1) * q2 - (1.0 - q1) * q3)) + 1.0);
+	}
+};
+
+//Distance source computing a coordinate metric on demand.
+template <class Metric>
+class CoordinateDistance
+{
+public:
+	explicit CoordinateDistance(const std::vector<City>& c) : cities(&c) {}
+	inline int operator()(int a, int b) const
+	{
+		return Metric::distance((*cities)[a], (*cities)[b]);
+	}
+private:
+	const std::vector<City>* cities;
+};
+
+//A full distance matrix, one row per city (its rows are bulk arrays, see
+//bulkMemory.cpp).
+typedef std::vector<BulkVector<int>> DistanceMatrix;
+
+//Distance source reading a full distance matrix (EXPLICIT instances, or the
+//matrix built for 2-Opt by loadGraphOfMapAsVectors).
+class MatrixDistance
+{
+public:
+	explicit MatrixDistance(const DistanceMatrix& m) : matrix(&m) {}
+	inline int operator()(int a, int b) const
+	{
+		return (*matrix)[a][b];
+	}
+private:
+	const DistanceMatrix* matrix;
+};
+
+//Distance source storing the lower triangle of the (symmetric) distance matrix
+//in one array: half the memory of a full matrix, for one extra multiply per
+//lookup.
+class TriangularMatrixDistance
+{
+public:
+	//(The weights are left unwritten until the pool's threads fill them, a block
+	//of rows each, with blocks of about equal size: see bulkMemory.hpp.)
+	template <class Distance>
+	TriangularMatrixDistance(int cityCount, const Distance& distance)
+		: weights(static_cast<long long>(cityCount) * (cityCount - 1) / 2)
+	{
+		ThreadPool pool(ThreadPool::defaultThreadCount());
+		int blockCount = pool.size();
+		for(int block = 0; block < blockCount; block++)
+		{
+			int first = static_cast<int>(cityCount * std::sqrt(static_cast<double>(block) / blockCount));
+			int last = static_cast<int>(cityCount * std::sqrt(static_cast<double>(block + 1) / blockCount));
+			pool.submit([this, &distance, first, last]()
+			{
+				for(int a = std::max(first, 1); a < last; a++)
+				{
+					long long row = static_cast<long long>(a) * (a - 1) / 2;
+					for(int b = 0; b < a; b++)
+					{
+						weights[row + b] = distance(a, b);
+					}
+				}
+			});
+		}
+		pool.wait();
+	}
+	//Takes over lowerTriangle, already in the layout above (e.g. computed while
+	//the input was read, see distanceTileConsumer in cityStream.cpp).
+	explicit TriangularMatrixDistance(BulkVector<int>& lowerTriangle)
+	{
+		weights.swap(lowerTriangle);
+	}
+	//Hands the weights back to lowerTriangle (the reverse of the above).
+	void release(BulkVector<int>& lowerTriangle)
+	{
+		weights.swap(lowerTriangle);
+	}
+	inline int operator()(int a, int b) const
+	{
+		if(a == b)
+		{
+			return 0;
+		}
+		if(a < b)
+		{
+			int temp = a;
+			a = b;
+			b = temp;
+		}
+		return weights[static_cast<long long>(a) * (a - 1) / 2 + b];
+	}
+private:
+	BulkVector<int> weights;
+};
+
+//Every distance source the solvers are compiled for. Modules whose templates
+//are implemented in a .cpp file instantiate them for each of these, e.g.
+//FOR_EACH_DISTANCE_SOURCE(INSTANTIATE_HELD_KARP) in heldKarpBound.cpp.
+#define FOR_EACH_DISTANCE_SOURCE(INSTANTIATE) \
+	INSTANTIATE(MatrixDistance) \
+	INSTANTIATE(TriangularMatrixDistance) \
+	INSTANTIATE(CoordinateDistance<Euclidean2D>) \
+	INSTANTIATE(CoordinateDistance<Ceiling2D>) \
+	INSTANTIATE(CoordinateDistance<PseudoEuclidean>) \
+	INSTANTIATE(CoordinateDistance<Geographical>)
+
+//Returns the total distance of a tour (including the edge back to the first city).
+template <class Distance>
+int tourLength(const std::vector<int>& tour, const Distance& distance)
+{
+	int length = 0;
+	for(int i = 0; i < static_cast<int>(tour.size()); i++)
+	{
+		length += distance(tour[i], tour[(i + 1) % tour.size()]);
+	}
+	return length;
+}
+
+/**************************************************************************************
+**                               withDistanceMetric                                  **
+** Calls solver(distance) with the distance source for the given edge weight type.   **
+** This is the only place the metric is chosen at run time; solver's operator() is   **
+** a template, so everything it calls is instantiated separately for each metric.    **
+**************************************************************************************/
+template <class Solver>
+void withDistanceMetric(EdgeWeightType edgeWeightType, const std::vector<City>& cities,
+                        const DistanceMatrix& edgeWeights, Solver& solver)
+{
+	switch(edgeWeightType)
+	{
+	case EUC_2D:
+		solver(CoordinateDistance<Euclidean2D>(cities));
+		break;
+	case CEIL_2D:
+		solver(CoordinateDistance<Ceiling2D>(cities));
+		break;
+	case ATT:
+		solver(CoordinateDistance<PseudoEuclidean>(cities));
+		break;
+	case GEO:
+		solver(CoordinateDistance<Geographical>(cities));
+		break;
+	case EXPLICIT:
+		solver(MatrixDistance(edgeWeights));
+		break;
+	}
+}
+
+#endif
@@ -0,0 +1,318 @@
+/******************************************************************************
+** Program name: tsplibReader.cpp
+** Class name: CS325-400
+** Author: Ben Fridkis
+** Date: 10/18/2026
+** Description: Reader for symmetric TSPLIB instances (.tsp files), see
+**				http://comopt.ifi.uni-heidelberg.de/software/TSPLIB95/.
+**				Supported edge weight types are EUC_2D, CEIL_2D, ATT, GEO
+**				and EXPLICIT (FULL_MATRIX, UPPER_ROW, LOWER_ROW,
+**				UPPER_DIAG_ROW and LOWER_DIAG_ROW formats). The input is
+**				read once, front to back, so it can be a pipe; coordinate
+**				sections are streamed through a CityStream (cityStream.cpp).
+*******************************************************************************/
+
+#include "tsplibReader.hpp"
+#include "cityStream.hpp"
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <cctype>
+using std::vector;
+using std::string;
+using std::ifstream;
+using std::istream;
+using std::getline;
+using std::endl;
+
+//Reports a problem with the input file and ends the program.
+static void tsplibError(const string& message)
+{
+	std::cerr << "\nInvalid TSPLIB file: " << message << "\n" << endl;
+	exit(1);
+}
+
+//Removes leading and trailing whitespace.
+static string trim(const string& s)
+{
+	size_t first = s.find_first_not_of(" \t\r\n");
+	if(first == string::npos)
+	{
+		return "";
+	}
+	size_t last = s.find_last_not_of(" \t\r\n");
+	return s.substr(first, last - first + 1);
+}
+
+//Puts the cities of a NODE_COORD_SECTION or DISPLAY_DATA_SECTION in place by
+//their city numbers. (TSPLIB numbers cities from 1.)
+static void placeByCityNumber(vector<City>& cities, int dimension)
+{
+	if(static_cast<int>(cities.size()) != dimension)
+	{
+		tsplibError("section does not have DIMENSION cities");
+	}
+	vector<City> placed(dimension);
+	vector<bool> seen(dimension, false);
+	for(int i = 0; i < dimension; i++)
+	{
+		int city = cities[i].id;
+		if(city < 1 || city > dimension || seen[city - 1])
+		{
+			tsplibError("bad coordinate line in section");
+		}
+		seen[city - 1] = true;
+		placed[city - 1] = City(city - 1, cities[i].x, cities[i].y);
+	}
+	cities.swap(placed);
+}
+
+//Returns the EdgeWeightType named by an EDGE_WEIGHT_TYPE line.
+static EdgeWeightType parseEdgeWeightType(const string& edgeWeightType)
+{
+	if(edgeWeightType == "EUC_2D")
+	{
+		return EUC_2D;
+	}
+	else if(edgeWeightType == "CEIL_2D")
+	{
+		return CEIL_2D;
+	}
+	else if(edgeWeightType == "ATT")
+	{
+		return ATT;
+	}
+	else if(edgeWeightType == "GEO")
+	{
+		return GEO;
+	}
+	else if(edgeWeightType == "EXPLICIT")
+	{
+		return EXPLICIT;
+	}
+	tsplibError("unsupported EDGE_WEIGHT_TYPE " + edgeWeightType);
+	return EXPLICIT;
+}
+
+/**************************************************************************************
+**                                readEdgeWeights                                    **
+** Reads an EDGE_WEIGHT_SECTION in the given format into a full (symmetric) matrix.  **
+**************************************************************************************/
+static void readEdgeWeights(istream& inputData, DistanceMatrix& edgeWeights,
+                            int dimension, const string& format)
+{
+	edgeWeights.assign(dimension, BulkVector<int>(dimension, 0));
+	for(int i = 0; i < dimension; i++)
+	{
+		int first, last;		//Columns present in row i: [first, last)
+		if(format == "FULL_MATRIX")
+		{
+			first = 0;
+			last = dimension;
+		}
+		else if(format == "UPPER_ROW")
+		{
+			first = i + 1;
+			last = dimension;
+		}
+		else if(format == "UPPER_DIAG_ROW")
+		{
+			first = i;
+			last = dimension;
+		}
+		else if(format == "LOWER_ROW")
+		{
+			first = 0;
+			last = i;
+		}
+		else if(format == "LOWER_DIAG_ROW")
+		{
+			first = 0;
+			last = i + 1;
+		}
+		else
+		{
+			tsplibError("unsupported EDGE_WEIGHT_FORMAT " + format);
+			return;
+		}
+		for(int j = first; j < last; j++)
+		{
+			int weight;
+			if(!(inputData >> weight))
+			{
+				tsplibError("EDGE_WEIGHT_SECTION is too short");
+			}
+			edgeWeights[i][j] = weight;
+			if(format != "FULL_MATRIX")
+			{
+				edgeWeights[j][i] = weight;
+			}
+		}
+	}
+}
+
+/**************************************************************************************
+**                               loadTsplibInstance                                  **
+** This function reads a TSPLIB instance: the "KEY : VALUE" specification lines,     **
+** followed by the data sections. Cities are renumbered from 0. The consumers setup  **
+** returns get the cities of the coordinate section while it is being read.          **
+**************************************************************************************/
+TspInstance loadTsplibInstance(istream& inputData, const StreamSetup& setup)
+{
+	TspInstance instance;
+	int dimension = -1;
+	string edgeWeightType, edgeWeightFormat = "FULL_MATRIX";
+	bool haveCoordinates = false, haveEdgeWeights = false;
+	string line;
+	bool lineRead = false;		//(A coordinate section ends by reading the next line.)
+
+	while(lineRead || getline(inputData, line))
+	{
+		lineRead = false;
+		line = trim(line);
+		if(line.empty())
+		{
+			continue;
+		}
+		string key = line, value;
+		size_t colon = line.find(':');
+		if(colon != string::npos)
+		{
+			key = trim(line.substr(0, colon));
+			value = trim(line.substr(colon + 1));
+		}
+
+		if(key == "EOF")
+		{
+			break;
+		}
+		else if(key == "NAME")
+		{
+			instance.name = value;
+		}
+		else if(key == "TYPE")
+		{
+			if(value != "TSP")
+			{
+				tsplibError("only symmetric TSP instances are supported (TYPE is " + value + ")");
+			}
+		}
+		else if(key == "DIMENSION")
+		{
+			dimension = atoi(value.c_str());
+		}
+		else if(key == "EDGE_WEIGHT_TYPE")
+		{
+			edgeWeightType = value;
+			instance.edgeWeightType = parseEdgeWeightType(edgeWeightType);
+		}
+		else if(key == "EDGE_WEIGHT_FORMAT")
+		{
+			edgeWeightFormat = value;
+		}
+		else if(key == "NODE_COORD_SECTION" || key == "DISPLAY_DATA_SECTION" ||
+		        key == "EDGE_WEIGHT_SECTION")
+		{
+			if(dimension <= 0)
+			{
+				tsplibError("DIMENSION must come before " + key);
+			}
+			if(edgeWeightType.empty())
+			{
+				tsplibError("EDGE_WEIGHT_TYPE must come before " + key);
+			}
+			if(key == "EDGE_WEIGHT_SECTION")
+			{
+				readEdgeWeights(inputData, instance.edgeWeights, dimension, edgeWeightFormat);
+				haveEdgeWeights = true;
+			}
+			else
+			{
+				CityStream stream(inputData, true);
+				if(instance.edgeWeightType != EXPLICIT)
+				{
+					vector<ChunkConsumer> consumers = setup(instance.edgeWeightType, dimension);
+					for(int i = 0; i < static_cast<int>(consumers.size()); i++)
+					{
+						stream.addConsumer(consumers[i]);
+					}
+				}
+				instance.cities = stream.run();
+				placeByCityNumber(instance.cities, dimension);
+				haveCoordinates = true;
+				line = stream.stopLine();
+				lineRead = !line.empty();
+			}
+		}
+		//(Other specification lines, e.g. COMMENT, are ignored.)
+	}
+
+	if(edgeWeightType.empty())
+	{
+		tsplibError("missing EDGE_WEIGHT_TYPE");
+	}
+	if(instance.edgeWeightType == EXPLICIT ? !haveEdgeWeights : !haveCoordinates)
+	{
+		tsplibError("missing data section for EDGE_WEIGHT_TYPE " + edgeWeightType);
+	}
+	instance.hasCoordinates = haveCoordinates;
+	if(!haveCoordinates)
+	{
+		//(Placeholder cities, so cities.size() is still the city count.)
+		for(int i = 0; i < dimension; i++)
+		{
+			instance.cities.push_back(City(i, 0, 0));
+		}
+	}
+
+	return instance;
+}
+
+/**************************************************************************************
+**                                loadTspInstance                                    **
+** Loads a TSPLIB instance if the file name ends in ".tsp", and otherwise the course **
+** format ("city x y" per line), which is EUC_2D. The name "-" reads stdin, where a  **
+** TSPLIB instance is recognized by its first line (a keyword, not a city number).   **
+** A FIFO can be given by name like any file.                                        **
+**************************************************************************************/
+TspInstance loadTspInstance(char* dataInputFileName, const StreamSetup& setup)
+{
+	if(dataInputFileName == nullptr){
+        std::cout << "\nMust enter file name when running program." << endl
+             << "Type './greedyTSP file.txt' in command line," << endl
+             << "replacing 'file.txt' with the name of your file" << endl
+             << "(or '-' to read the cities from stdin).\n" << endl;
+        exit(1);
+    }
+	string fileName = dataInputFileName;
+	ifstream inputFile;
+	istream* inputData = &std::cin;
+	bool tsplib;
+	if(fileName == "-")
+	{
+		//(Line reads from cin are much faster without the stdio synchronization.)
+		std::ios::sync_with_stdio(false);
+		std::cin >> std::ws;
+		tsplib = isalpha(std::cin.peek()) != 0;
+	}
+	else
+	{
+		inputFile.open(dataInputFileName);
+		if(!inputFile)
+		{
+			std::cerr << "\nFile cannot be found or opened.\n" << endl;
+			exit(1);
+		}
+		inputData = &inputFile;
+		tsplib = fileName.size() > 4 && fileName.compare(fileName.size() - 4, 4, ".tsp") == 0;
+	}
+	if(tsplib)
+	{
+		return loadTsplibInstance(*inputData, setup);
+	}
+	TspInstance instance;
+	instance.cities = loadCities(*inputData, setup(EUC_2D, 0));
+	return instance;
+}
@@ -0,0 +1,46 @@
+/******************************************************************************
+** Program name: tsplibReader.hpp
+** Class name: CS325-400
+** Author: Ben Fridkis
+** Date: 10/18/2026
+** Description: Declarations for loading TSP instances, either in the course
+**				format ("city x y" per line, Euclidean) or in the TSPLIB
+**				.tsp format, from a file, a FIFO or stdin.
+*******************************************************************************/
+
+#ifndef TSPLIB_READER_HPP
+#define TSPLIB_READER_HPP
+
+#include <vector>
+#include <string>
+#include <istream>
+#include <functional>
+#include "tspCities.hpp"
+#include "tspMetrics.hpp"
+
+//A loaded TSP instance. Cities are always indexed 0..n-1. For EXPLICIT
+//instances the distances are in edgeWeights, and the cities only have
+//coordinates if the file has a DISPLAY_DATA_SECTION (hasCoordinates).
+struct TspInstance{
+	std::string name;
+	EdgeWeightType edgeWeightType;
+	std::vector<City> cities;
+	DistanceMatrix edgeWeights;
+	bool hasCoordinates;
+	TspInstance()
+	{
+		edgeWeightType = EUC_2D;
+		hasCoordinates = true;
+	}
+};
+
+//Chooses the consumers that work on the cities while they are still being read
+//(see cityStream.cpp), given the edge weight type and the number of cities
+//expected (the TSPLIB DIMENSION, or 0 if not known yet).
+typedef std::function<std::vector<ChunkConsumer>(EdgeWeightType, int)> StreamSetup;
+
+TspInstance loadTsplibInstance(std::istream& inputData, const StreamSetup& setup);
+
+TspInstance loadTspInstance(char* dataInputFileName, const StreamSetup& setup);
+
+#endif